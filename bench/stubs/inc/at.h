@@ -0,0 +1,97 @@
+/*
+ * at.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __AT_H__
+#define __AT_H__
+
+#include "parser.h"
+#include "strings.h"
+#include "types.h"
+
+/*** AT macros ***/
+
+#define AT_COMMANDS_NUMBER          32
+#define AT_BUFFER_SIZE_BYTES        128
+
+#define AT_exit_error(base) { if (at_status != AT_SUCCESS) { status = (base + at_status); goto errors; } }
+
+/*** AT structures ***/
+
+/*!******************************************************************
+ * \enum AT_status_t
+ * \brief AT driver error codes.
+ *******************************************************************/
+typedef enum {
+    AT_SUCCESS = 0,
+    AT_ERROR_NULL_PARAMETER,
+    AT_ERROR_COMMAND_EXECUTION,
+    AT_ERROR_COMMANDS_LIST_FULL,
+    AT_ERROR_COMMAND_NOT_FOUND,
+    AT_ERROR_BASE_PARSER = 0x0100,
+    AT_ERROR_BASE_LAST = (AT_ERROR_BASE_PARSER + PARSER_ERROR_BASE_LAST)
+} AT_status_t;
+
+/*!******************************************************************
+ * \fn AT_process_cb_t
+ * \brief Command reception callback.
+ *******************************************************************/
+typedef void (*AT_process_cb_t)(void);
+
+/*!******************************************************************
+ * \fn AT_configuration_t
+ * \brief AT configuration structure.
+ *******************************************************************/
+typedef struct {
+    uint8_t terminal_instance;
+    AT_process_cb_t process_callback;
+} AT_configuration_t;
+
+/*!******************************************************************
+ * \fn AT_command_t
+ * \brief AT command descriptor.
+ *******************************************************************/
+typedef struct {
+    char_t* syntax;
+    char_t* parameters;
+    char_t* description;
+    AT_status_t (*callback)(void);
+} AT_command_t;
+
+/*** AT functions ***/
+
+// Host stub implementation, only the functions used by the UNA AT library are provided.
+AT_status_t AT_init(AT_configuration_t* configuration, PARSER_context_t** parser_context_ptr);
+AT_status_t AT_de_init(void);
+AT_status_t AT_register_command(const AT_command_t* command);
+AT_status_t AT_unregister_command(const AT_command_t* command);
+AT_status_t AT_process(void);
+void AT_reply_add_string(char_t* str);
+void AT_reply_add_integer(int32_t value, STRING_format_t format, uint8_t print_prefix);
+void AT_reply_add_byte_array(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix);
+void AT_send_reply(void);
+
+/*** AT stub functions ***/
+
+/*!******************************************************************
+ * \fn void AT_STUB_receive_command(char_t* command)
+ * \brief Simulate the reception of a command line.
+ * \param[in]   command: Null-terminated command, without ending marker.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void AT_STUB_receive_command(char_t* command);
+
+/*!******************************************************************
+ * \fn char_t* AT_STUB_get_sent_replies(void)
+ * \brief Get and clear the reply lines sent since the last call.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Null-terminated copy of the sent lines.
+ *******************************************************************/
+char_t* AT_STUB_get_sent_replies(void);
+
+#endif /* __AT_H__ */
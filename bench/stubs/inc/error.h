@@ -0,0 +1,21 @@
+/*
+ * error.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ERROR_H__
+#define __ERROR_H__
+
+#include "types.h"
+
+/*** ERROR macros ***/
+
+#define ERROR_BASE_STEP     0x0100
+
+#define ERROR_check_exit(status, success, error_base) { if (status != success) { status = (error_base + status); goto errors; } }
+#define ERROR_check_stack(status, success, error_base) { if (status != success) { (void) (error_base + status); } }
+#define ERROR_check_stack_exit(status, success, error_base, error_code) { if (status != success) { status = error_code; goto errors; } }
+
+#endif /* __ERROR_H__ */
@@ -0,0 +1,13 @@
+/*
+ * maths.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MATHS_H__
+#define __MATHS_H__
+
+#include "types.h"
+
+#endif /* __MATHS_H__ */
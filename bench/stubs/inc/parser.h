@@ -0,0 +1,62 @@
+/*
+ * parser.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __PARSER_H__
+#define __PARSER_H__
+
+#include "strings.h"
+#include "types.h"
+
+/*** PARSER macros ***/
+
+#define PARSER_exit_error(base) { if (parser_status != PARSER_SUCCESS) { status = (base + parser_status); goto errors; } }
+
+/*** PARSER structures ***/
+
+/*!******************************************************************
+ * \enum PARSER_status_t
+ * \brief PARSER driver error codes.
+ *******************************************************************/
+typedef enum {
+    PARSER_SUCCESS = 0,
+    PARSER_ERROR_NULL_PARAMETER,
+    PARSER_ERROR_REFERENCE_NOT_FOUND,
+    PARSER_ERROR_SEPARATOR_NOT_FOUND,
+    PARSER_ERROR_PARAMETER_EMPTY,
+    PARSER_ERROR_PARAMETER_INVALID,
+    PARSER_ERROR_PARAMETER_OVERFLOW,
+    PARSER_ERROR_BASE_LAST = 0x0100
+} PARSER_status_t;
+
+/*!******************************************************************
+ * \enum PARSER_mode_t
+ * \brief PARSER comparison modes.
+ *******************************************************************/
+typedef enum {
+    PARSER_MODE_STRICT = 0,
+    PARSER_MODE_HEADER,
+    PARSER_MODE_LAST
+} PARSER_mode_t;
+
+/*!******************************************************************
+ * \fn PARSER_context_t
+ * \brief PARSER context structure.
+ *******************************************************************/
+typedef struct {
+    char_t* buffer;
+    uint32_t buffer_size;
+    uint32_t separator_index;
+    uint32_t start_index;
+} PARSER_context_t;
+
+/*** PARSER functions ***/
+
+// Host stub implementation, only the functions used by the UNA AT library are provided.
+PARSER_status_t PARSER_compare(PARSER_context_t* parser_ctx, PARSER_mode_t mode, char_t* reference);
+PARSER_status_t PARSER_get_byte_array(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size_bytes, uint8_t exact_size, uint8_t* data, uint32_t* extracted_size_bytes);
+
+#endif /* __PARSER_H__ */
@@ -0,0 +1,34 @@
+/*
+ * strings.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __STRINGS_H__
+#define __STRINGS_H__
+
+#include "types.h"
+
+/*** STRING macros ***/
+
+#define STRING_CHAR_NULL    '\0'
+#define STRING_CHAR_LF      '\n'
+#define STRING_CHAR_CR      '\r'
+#define STRING_CHAR_SPACE   ' '
+#define STRING_CHAR_COMMA   ','
+
+/*** STRING structures ***/
+
+/*!******************************************************************
+ * \enum STRING_format_t
+ * \brief String formats list.
+ *******************************************************************/
+typedef enum {
+    STRING_FORMAT_BINARY = 0,
+    STRING_FORMAT_HEXADECIMAL,
+    STRING_FORMAT_DECIMAL,
+    STRING_FORMAT_LAST
+} STRING_format_t;
+
+#endif /* __STRINGS_H__ */
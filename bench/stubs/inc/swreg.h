@@ -0,0 +1,20 @@
+/*
+ * swreg.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SWREG_H__
+#define __SWREG_H__
+
+#include "parser.h"
+#include "types.h"
+
+/*** SWREG functions ***/
+
+// Host stub implementation, only the functions used by the UNA AT library are provided.
+PARSER_status_t SWREG_parse_register(PARSER_context_t* parser_ctx, char_t separator, uint32_t* reg_value);
+uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask);
+
+#endif /* __SWREG_H__ */
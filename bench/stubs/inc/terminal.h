@@ -0,0 +1,91 @@
+/*
+ * terminal.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TERMINAL_H__
+#define __TERMINAL_H__
+
+#include "strings.h"
+#include "types.h"
+
+/*** TERMINAL macros ***/
+
+#define TERMINAL_INSTANCES_NUMBER       2
+#define TERMINAL_BUFFER_SIZE_BYTES      128
+
+#define TERMINAL_exit_error(base) { if (terminal_status != TERMINAL_SUCCESS) { status = (base + terminal_status); goto errors; } }
+
+/*** TERMINAL structures ***/
+
+/*!******************************************************************
+ * \enum TERMINAL_status_t
+ * \brief TERMINAL driver error codes.
+ *******************************************************************/
+typedef enum {
+    TERMINAL_SUCCESS = 0,
+    TERMINAL_ERROR_NULL_PARAMETER,
+    TERMINAL_ERROR_INSTANCE,
+    TERMINAL_ERROR_TX_BUFFER_OVERFLOW,
+    TERMINAL_ERROR_BASE_LAST = 0x0100
+} TERMINAL_status_t;
+
+/*!******************************************************************
+ * \fn TERMINAL_rx_irq_cb_t
+ * \brief Byte reception interrupt callback.
+ *******************************************************************/
+typedef void (*TERMINAL_rx_irq_cb_t)(uint8_t data);
+
+/*!******************************************************************
+ * \fn TERMINAL_bus_cb_t
+ * \brief Stub callback called when the receiver is enabled, to simulate the remote node reply.
+ *******************************************************************/
+typedef void (*TERMINAL_bus_cb_t)(uint8_t instance);
+
+/*** TERMINAL functions ***/
+
+// Host stub implementation, only the functions used by the UNA AT library are provided.
+TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, TERMINAL_rx_irq_cb_t rx_irq_callback);
+TERMINAL_status_t TERMINAL_close(uint8_t instance);
+TERMINAL_status_t TERMINAL_enable_rx(uint8_t instance);
+TERMINAL_status_t TERMINAL_disable_rx(uint8_t instance);
+TERMINAL_status_t TERMINAL_set_destination_address(uint8_t instance, uint8_t destination_address);
+TERMINAL_status_t TERMINAL_flush_tx_buffer(uint8_t instance);
+TERMINAL_status_t TERMINAL_tx_buffer_add_string(uint8_t instance, char_t* str);
+TERMINAL_status_t TERMINAL_tx_buffer_add_integer(uint8_t instance, int32_t value, STRING_format_t format, uint8_t print_prefix);
+TERMINAL_status_t TERMINAL_tx_buffer_add_byte_array(uint8_t instance, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix);
+TERMINAL_status_t TERMINAL_send_tx_buffer(uint8_t instance);
+
+/*** TERMINAL stub functions ***/
+
+/*!******************************************************************
+ * \fn void TERMINAL_STUB_set_bus_callback(uint8_t instance, TERMINAL_bus_cb_t bus_callback)
+ * \brief Register the function simulating the remote node of a terminal.
+ * \param[in]   instance: Terminal instance.
+ * \param[in]   bus_callback: Function called when the receiver is enabled.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TERMINAL_STUB_set_bus_callback(uint8_t instance, TERMINAL_bus_cb_t bus_callback);
+
+/*!******************************************************************
+ * \fn TERMINAL_rx_irq_cb_t TERMINAL_STUB_get_rx_irq_callback(uint8_t instance)
+ * \brief Get the reception callback given when opening a terminal.
+ * \param[in]   instance: Terminal instance.
+ * \param[out]  none
+ * \retval      Reception callback (NULL if the terminal is closed).
+ *******************************************************************/
+TERMINAL_rx_irq_cb_t TERMINAL_STUB_get_rx_irq_callback(uint8_t instance);
+
+/*!******************************************************************
+ * \fn char_t* TERMINAL_STUB_get_sent_buffer(uint8_t instance, uint8_t* destination_address)
+ * \brief Get the last buffer sent on a terminal.
+ * \param[in]   instance: Terminal instance.
+ * \param[out]  destination_address: Destination address of the last buffer.
+ * \retval      Null-terminated copy of the last sent buffer.
+ *******************************************************************/
+char_t* TERMINAL_STUB_get_sent_buffer(uint8_t instance, uint8_t* destination_address);
+
+#endif /* __TERMINAL_H__ */
@@ -0,0 +1,22 @@
+/*
+ * types.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TYPES_H__
+#define __TYPES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*** TYPES macros ***/
+
+#define UNUSED(x)   ((void) x)
+
+/*** TYPES structures ***/
+
+typedef char char_t;
+
+#endif /* __TYPES_H__ */
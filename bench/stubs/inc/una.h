@@ -0,0 +1,102 @@
+/*
+ * una.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_H__
+#define __UNA_H__
+
+#include "types.h"
+
+/*** UNA macros ***/
+
+#define UNA_REGISTER_SIZE_BYTES         4
+#define UNA_REGISTER_MASK_ALL           0xFFFFFFFF
+
+#define UNA_NODE_ADDRESS_MASTER         0x00
+#define UNA_NODE_ADDRESS_R4S8CR_START   0x70
+
+/*** UNA structures ***/
+
+typedef uint8_t UNA_node_address_t;
+
+/*!******************************************************************
+ * \enum UNA_access_type_t
+ * \brief Register access types.
+ *******************************************************************/
+typedef enum {
+    UNA_ACCESS_TYPE_READ = 0,
+    UNA_ACCESS_TYPE_WRITE
+} UNA_access_type_t;
+
+/*!******************************************************************
+ * \enum UNA_reply_type_t
+ * \brief Node reply types.
+ *******************************************************************/
+typedef enum {
+    UNA_REPLY_TYPE_NONE = 0,
+    UNA_REPLY_TYPE_OK,
+    UNA_REPLY_TYPE_VALUE,
+    UNA_REPLY_TYPE_LAST
+} UNA_reply_type_t;
+
+/*!******************************************************************
+ * \fn UNA_reply_parameters_t
+ * \brief Node reply parameters.
+ *******************************************************************/
+typedef struct {
+    UNA_reply_type_t type;
+    uint32_t timeout_ms;
+} UNA_reply_parameters_t;
+
+/*!******************************************************************
+ * \fn UNA_access_parameters_t
+ * \brief Register access parameters.
+ *******************************************************************/
+typedef struct {
+    UNA_node_address_t node_addr;
+    uint8_t reg_addr;
+    UNA_reply_parameters_t reply_params;
+} UNA_access_parameters_t;
+
+/*!******************************************************************
+ * \fn UNA_command_parameters_t
+ * \brief Raw command parameters.
+ *******************************************************************/
+typedef struct {
+    UNA_node_address_t node_addr;
+    char_t* command;
+} UNA_command_parameters_t;
+
+/*!******************************************************************
+ * \fn UNA_node_t
+ * \brief Node descriptor.
+ *******************************************************************/
+typedef struct {
+    UNA_node_address_t address;
+    uint16_t board_id;
+} UNA_node_t;
+
+/*!******************************************************************
+ * \fn UNA_access_status_t
+ * \brief Register access status.
+ *******************************************************************/
+typedef union {
+    struct {
+        unsigned error_received : 1;
+        unsigned parser_error : 1;
+        unsigned reply_timeout : 1;
+        unsigned sequence_timeout : 1;
+        unsigned access_timeout : 1;
+        unsigned type : 1;
+    };
+    struct {
+        unsigned flags : 5;
+        unsigned : 3;
+    };
+    uint8_t all;
+} UNA_access_status_t;
+
+#endif /* __UNA_H__ */
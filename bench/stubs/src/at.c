@@ -0,0 +1,277 @@
+/*
+ * at.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "at.h"
+
+#include "parser.h"
+#include "strings.h"
+#include "types.h"
+
+/*** AT local macros ***/
+
+#define AT_HEADER               "AT"
+#define AT_REPLY_OK             "OK"
+#define AT_REPLY_ERROR          "ERROR"
+#define AT_REPLY_END            STRING_CHAR_CR
+
+#define AT_SENT_SIZE_BYTES      (AT_BUFFER_SIZE_BYTES << 1)
+
+#define AT_HEXADECIMAL          "0123456789ABCDEF"
+
+/*** AT local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    AT_process_cb_t process_callback;
+    const AT_command_t* commands[AT_COMMANDS_NUMBER];
+    char_t command[AT_BUFFER_SIZE_BYTES];
+    PARSER_context_t parser;
+    char_t reply[AT_BUFFER_SIZE_BYTES];
+    uint32_t reply_size;
+    char_t sent[AT_SENT_SIZE_BYTES];
+    uint32_t sent_size;
+    char_t sent_copy[AT_SENT_SIZE_BYTES];
+} AT_context_t;
+
+/*** AT local global variables ***/
+
+static AT_context_t at_ctx;
+
+/*** AT local functions ***/
+
+/*******************************************************************/
+static void _AT_reply_add_character(char_t character) {
+    // Keep the last byte for the null terminator.
+    if (at_ctx.reply_size >= (AT_BUFFER_SIZE_BYTES - 1)) return;
+    at_ctx.reply[at_ctx.reply_size++] = character;
+    at_ctx.reply[at_ctx.reply_size] = STRING_CHAR_NULL;
+}
+
+/*******************************************************************/
+static uint8_t _AT_match_syntax(char_t* line, char_t* syntax) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Compare characters.
+    while (syntax[idx] != STRING_CHAR_NULL) {
+        if (line[idx] != syntax[idx]) return 0;
+        idx++;
+    }
+    return 1;
+}
+
+/*** AT functions ***/
+
+/*******************************************************************/
+AT_status_t AT_init(AT_configuration_t* configuration, PARSER_context_t** parser_context_ptr) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((configuration == NULL) || (parser_context_ptr == NULL)) {
+        status = AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    at_ctx.process_callback = (configuration->process_callback);
+    for (idx = 0; idx < AT_COMMANDS_NUMBER; idx++) {
+        at_ctx.commands[idx] = NULL;
+    }
+    at_ctx.command[0] = STRING_CHAR_NULL;
+    at_ctx.parser.buffer = at_ctx.command;
+    at_ctx.parser.buffer_size = 0;
+    at_ctx.parser.separator_index = 0;
+    at_ctx.parser.start_index = 0;
+    at_ctx.reply_size = 0;
+    at_ctx.sent_size = 0;
+    (*parser_context_ptr) = &(at_ctx.parser);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+AT_status_t AT_de_init(void) {
+    at_ctx.process_callback = NULL;
+    return AT_SUCCESS;
+}
+
+/*******************************************************************/
+AT_status_t AT_register_command(const AT_command_t* command) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameter.
+    if (command == NULL) {
+        status = AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Search free slot.
+    for (idx = 0; idx < AT_COMMANDS_NUMBER; idx++) {
+        if (at_ctx.commands[idx] == NULL) break;
+    }
+    if (idx >= AT_COMMANDS_NUMBER) {
+        status = AT_ERROR_COMMANDS_LIST_FULL;
+        goto errors;
+    }
+    at_ctx.commands[idx] = command;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+AT_status_t AT_unregister_command(const AT_command_t* command) {
+    // Local variables.
+    AT_status_t status = AT_ERROR_COMMAND_NOT_FOUND;
+    uint32_t idx = 0;
+    // Search command.
+    for (idx = 0; idx < AT_COMMANDS_NUMBER; idx++) {
+        if (at_ctx.commands[idx] == command) {
+            at_ctx.commands[idx] = NULL;
+            status = AT_SUCCESS;
+            break;
+        }
+    }
+    return status;
+}
+
+/*******************************************************************/
+AT_status_t AT_process(void) {
+    // Local variables.
+    AT_status_t status = AT_ERROR_COMMAND_NOT_FOUND;
+    const AT_command_t* command = NULL;
+    uint32_t idx = 0;
+    // Check header.
+    if (_AT_match_syntax(at_ctx.command, AT_HEADER) == 0) goto errors;
+    // Search command.
+    for (idx = 0; idx < AT_COMMANDS_NUMBER; idx++) {
+        command = at_ctx.commands[idx];
+        if ((command != NULL) && (_AT_match_syntax(&(at_ctx.command[sizeof(AT_HEADER) - 1]), (command->syntax)) != 0)) break;
+        command = NULL;
+    }
+    if (command == NULL) goto errors;
+    // Parameters start after the syntax.
+    at_ctx.parser.start_index = (sizeof(AT_HEADER) - 1);
+    while ((command->syntax)[at_ctx.parser.start_index - (sizeof(AT_HEADER) - 1)] != STRING_CHAR_NULL) {
+        at_ctx.parser.start_index++;
+    }
+    at_ctx.parser.separator_index = at_ctx.parser.start_index;
+    status = (command->callback)();
+errors:
+    // Send status.
+    AT_reply_add_string((status == AT_SUCCESS) ? AT_REPLY_OK : AT_REPLY_ERROR);
+    AT_send_reply();
+    return AT_SUCCESS;
+}
+
+/*******************************************************************/
+void AT_reply_add_string(char_t* str) {
+    // Copy characters.
+    while ((str != NULL) && ((*str) != STRING_CHAR_NULL)) {
+        _AT_reply_add_character(*(str++));
+    }
+}
+
+/*******************************************************************/
+void AT_reply_add_integer(int32_t value, STRING_format_t format, uint8_t print_prefix) {
+    // Local variables.
+    char_t digits[10];
+    uint32_t absolute_value = (uint32_t) value;
+    uint8_t digit_count = 0;
+    uint8_t idx = 0;
+    if (format == STRING_FORMAT_DECIMAL) {
+        // Print sign.
+        if (value < 0) {
+            _AT_reply_add_character('-');
+            absolute_value = (uint32_t) (-value);
+        }
+        // Compute digits in reverse order.
+        do {
+            digits[digit_count++] = (char_t) ('0' + (absolute_value % 10));
+            absolute_value /= 10;
+        }
+        while (absolute_value != 0);
+        for (idx = 0; idx < digit_count; idx++) {
+            _AT_reply_add_character(digits[digit_count - 1 - idx]);
+        }
+    }
+    else {
+        // Hexadecimal values are printed with the minimum number of bytes.
+        if (print_prefix != 0) {
+            AT_reply_add_string("0x");
+        }
+        for (idx = 0; idx < 3; idx++) {
+            if ((absolute_value >> ((3 - idx) << 3)) != 0) break;
+        }
+        for (; idx < 4; idx++) {
+            _AT_reply_add_character(AT_HEXADECIMAL[(absolute_value >> (((3 - idx) << 3) + 4)) & 0x0F]);
+            _AT_reply_add_character(AT_HEXADECIMAL[(absolute_value >> ((3 - idx) << 3)) & 0x0F]);
+        }
+    }
+}
+
+/*******************************************************************/
+void AT_reply_add_byte_array(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameter.
+    if (data == NULL) return;
+    if (print_prefix != 0) {
+        AT_reply_add_string("0x");
+    }
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        _AT_reply_add_character(AT_HEXADECIMAL[(data[idx] >> 4) & 0x0F]);
+        _AT_reply_add_character(AT_HEXADECIMAL[data[idx] & 0x0F]);
+    }
+}
+
+/*******************************************************************/
+void AT_send_reply(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Record the line on the simulated bus.
+    for (idx = 0; idx < at_ctx.reply_size; idx++) {
+        if (at_ctx.sent_size >= (AT_SENT_SIZE_BYTES - 2)) break;
+        at_ctx.sent[at_ctx.sent_size++] = at_ctx.reply[idx];
+    }
+    at_ctx.sent[at_ctx.sent_size++] = AT_REPLY_END;
+    at_ctx.sent[at_ctx.sent_size] = STRING_CHAR_NULL;
+    // Flush reply buffer.
+    at_ctx.reply_size = 0;
+    at_ctx.reply[0] = STRING_CHAR_NULL;
+}
+
+/*** AT stub functions ***/
+
+/*******************************************************************/
+void AT_STUB_receive_command(char_t* command) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Copy command in the parser buffer.
+    while ((command[idx] != STRING_CHAR_NULL) && (idx < (AT_BUFFER_SIZE_BYTES - 1))) {
+        at_ctx.command[idx] = command[idx];
+        idx++;
+    }
+    at_ctx.command[idx] = STRING_CHAR_NULL;
+    at_ctx.parser.buffer_size = idx;
+    at_ctx.parser.separator_index = 0;
+    at_ctx.parser.start_index = 0;
+    // Notify the end of line as the reception interrupt would do.
+    if (at_ctx.process_callback != NULL) {
+        at_ctx.process_callback();
+    }
+}
+
+/*******************************************************************/
+char_t* AT_STUB_get_sent_replies(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Copy and clear the sent lines.
+    for (idx = 0; idx <= at_ctx.sent_size; idx++) {
+        at_ctx.sent_copy[idx] = at_ctx.sent[idx];
+    }
+    at_ctx.sent_size = 0;
+    at_ctx.sent[0] = STRING_CHAR_NULL;
+    return at_ctx.sent_copy;
+}
@@ -0,0 +1,129 @@
+/*
+ * parser.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "parser.h"
+
+#include "strings.h"
+#include "types.h"
+
+/*** PARSER local functions ***/
+
+/*******************************************************************/
+static uint8_t _PARSER_hexadecimal_to_value(char_t character, uint8_t* value) {
+    // Local variables.
+    uint8_t valid_flag = 1;
+    // Convert character.
+    if ((character >= '0') && (character <= '9')) {
+        (*value) = (uint8_t) (character - '0');
+    }
+    else if ((character >= 'A') && (character <= 'F')) {
+        (*value) = (uint8_t) (character - 'A' + 10);
+    }
+    else if ((character >= 'a') && (character <= 'f')) {
+        (*value) = (uint8_t) (character - 'a' + 10);
+    }
+    else {
+        valid_flag = 0;
+    }
+    return valid_flag;
+}
+
+/*******************************************************************/
+static PARSER_status_t _PARSER_search_separator(PARSER_context_t* parser_ctx, char_t separator) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    uint32_t idx = (parser_ctx->start_index);
+    // The null separator designates the end of the buffer.
+    if (separator == STRING_CHAR_NULL) {
+        (parser_ctx->separator_index) = (parser_ctx->buffer_size);
+        goto errors;
+    }
+    for (; idx < (parser_ctx->buffer_size); idx++) {
+        if ((parser_ctx->buffer)[idx] == separator) break;
+    }
+    if (idx >= (parser_ctx->buffer_size)) {
+        status = PARSER_ERROR_SEPARATOR_NOT_FOUND;
+        goto errors;
+    }
+    (parser_ctx->separator_index) = idx;
+errors:
+    return status;
+}
+
+/*** PARSER functions ***/
+
+/*******************************************************************/
+PARSER_status_t PARSER_compare(PARSER_context_t* parser_ctx, PARSER_mode_t mode, char_t* reference) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((parser_ctx == NULL) || (reference == NULL)) {
+        status = PARSER_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Compare characters.
+    while (reference[idx] != STRING_CHAR_NULL) {
+        if ((((parser_ctx->start_index) + idx) >= (parser_ctx->buffer_size)) || ((parser_ctx->buffer)[(parser_ctx->start_index) + idx] != reference[idx])) {
+            status = PARSER_ERROR_REFERENCE_NOT_FOUND;
+            goto errors;
+        }
+        idx++;
+    }
+    // The whole buffer must match in strict mode.
+    if ((mode == PARSER_MODE_STRICT) && (((parser_ctx->start_index) + idx) != (parser_ctx->buffer_size))) {
+        status = PARSER_ERROR_REFERENCE_NOT_FOUND;
+        goto errors;
+    }
+    // Parameters start after the header.
+    (parser_ctx->start_index) += idx;
+    (parser_ctx->separator_index) = (parser_ctx->start_index);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+PARSER_status_t PARSER_get_byte_array(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size_bytes, uint8_t exact_size, uint8_t* data, uint32_t* extracted_size_bytes) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    uint32_t idx = 0;
+    uint8_t high = 0;
+    uint8_t low = 0;
+    // Check parameters.
+    if ((parser_ctx == NULL) || (data == NULL) || (extracted_size_bytes == NULL)) {
+        status = PARSER_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*extracted_size_bytes) = 0;
+    status = _PARSER_search_separator(parser_ctx, separator);
+    if (status != PARSER_SUCCESS) goto errors;
+    // Check length.
+    if ((parser_ctx->separator_index) == (parser_ctx->start_index)) {
+        status = PARSER_ERROR_PARAMETER_EMPTY;
+        goto errors;
+    }
+    if (((((parser_ctx->separator_index) - (parser_ctx->start_index)) % 2) != 0) || ((((parser_ctx->separator_index) - (parser_ctx->start_index)) >> 1) > maximum_size_bytes)) {
+        status = PARSER_ERROR_PARAMETER_OVERFLOW;
+        goto errors;
+    }
+    if ((exact_size != 0) && ((((parser_ctx->separator_index) - (parser_ctx->start_index)) >> 1) != maximum_size_bytes)) {
+        status = PARSER_ERROR_PARAMETER_INVALID;
+        goto errors;
+    }
+    // Convert bytes.
+    for (idx = (parser_ctx->start_index); idx < (parser_ctx->separator_index); idx += 2) {
+        if ((_PARSER_hexadecimal_to_value((parser_ctx->buffer)[idx], &high) == 0) || (_PARSER_hexadecimal_to_value((parser_ctx->buffer)[idx + 1], &low) == 0)) {
+            status = PARSER_ERROR_PARAMETER_INVALID;
+            goto errors;
+        }
+        data[(*extracted_size_bytes)++] = (uint8_t) ((high << 4) + low);
+    }
+    // Go to next parameter.
+    (parser_ctx->start_index) = (parser_ctx->separator_index) + 1;
+errors:
+    return status;
+}
@@ -0,0 +1,90 @@
+/*
+ * swreg.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "swreg.h"
+
+#include "parser.h"
+#include "strings.h"
+#include "types.h"
+
+/*** SWREG local macros ***/
+
+#define SWREG_REGISTER_SIZE_DIGITS  8
+
+/*** SWREG functions ***/
+
+/*******************************************************************/
+PARSER_status_t SWREG_parse_register(PARSER_context_t* parser_ctx, char_t separator, uint32_t* reg_value) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    uint32_t end_idx = 0;
+    uint32_t idx = 0;
+    uint32_t value = 0;
+    char_t character = STRING_CHAR_NULL;
+    // Check parameters.
+    if ((parser_ctx == NULL) || (reg_value == NULL)) {
+        status = PARSER_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Search parameter end, the null separator designates the end of the buffer.
+    end_idx = (parser_ctx->start_index);
+    while ((end_idx < (parser_ctx->buffer_size)) && ((parser_ctx->buffer)[end_idx] != separator)) {
+        end_idx++;
+    }
+    if ((separator != STRING_CHAR_NULL) && (end_idx >= (parser_ctx->buffer_size))) {
+        status = PARSER_ERROR_SEPARATOR_NOT_FOUND;
+        goto errors;
+    }
+    // Check length.
+    if (end_idx == (parser_ctx->start_index)) {
+        status = PARSER_ERROR_PARAMETER_EMPTY;
+        goto errors;
+    }
+    if ((end_idx - (parser_ctx->start_index)) > SWREG_REGISTER_SIZE_DIGITS) {
+        status = PARSER_ERROR_PARAMETER_OVERFLOW;
+        goto errors;
+    }
+    // Convert hexadecimal digits.
+    for (idx = (parser_ctx->start_index); idx < end_idx; idx++) {
+        character = (parser_ctx->buffer)[idx];
+        if ((character >= '0') && (character <= '9')) {
+            value = (value << 4) + (uint32_t) (character - '0');
+        }
+        else if ((character >= 'A') && (character <= 'F')) {
+            value = (value << 4) + (uint32_t) (character - 'A' + 10);
+        }
+        else if ((character >= 'a') && (character <= 'f')) {
+            value = (value << 4) + (uint32_t) (character - 'a' + 10);
+        }
+        else {
+            status = PARSER_ERROR_PARAMETER_INVALID;
+            goto errors;
+        }
+    }
+    (*reg_value) = value;
+    // Go to next parameter.
+    (parser_ctx->separator_index) = end_idx;
+    (parser_ctx->start_index) = (separator != STRING_CHAR_NULL) ? (end_idx + 1) : end_idx;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask) {
+    // Local variables.
+    uint32_t field_value = 0;
+    // Check mask.
+    if (field_mask == 0) goto errors;
+    // Shift field to the LSB.
+    field_value = (reg_value & field_mask);
+    while ((field_mask & 0x00000001) == 0) {
+        field_mask >>= 1;
+        field_value >>= 1;
+    }
+errors:
+    return field_value;
+}
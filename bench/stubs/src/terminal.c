@@ -0,0 +1,293 @@
+/*
+ * terminal.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "terminal.h"
+
+#include "strings.h"
+#include "types.h"
+
+/*** TERMINAL local macros ***/
+
+#define TERMINAL_HEXADECIMAL    "0123456789ABCDEF"
+
+/*** TERMINAL local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    TERMINAL_rx_irq_cb_t rx_irq_callback;
+    TERMINAL_bus_cb_t bus_callback;
+    char_t tx_buffer[TERMINAL_BUFFER_SIZE_BYTES];
+    uint32_t tx_buffer_size;
+    char_t sent_buffer[TERMINAL_BUFFER_SIZE_BYTES];
+    uint8_t destination_address;
+    uint8_t sent_destination_address;
+} TERMINAL_context_t;
+
+/*** TERMINAL local global variables ***/
+
+static TERMINAL_context_t terminal_ctx[TERMINAL_INSTANCES_NUMBER];
+
+/*** TERMINAL local functions ***/
+
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_tx_buffer_add_character(uint8_t instance, char_t character) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Keep the last byte for the null terminator.
+    if (terminal_ctx[instance].tx_buffer_size >= (TERMINAL_BUFFER_SIZE_BYTES - 1)) {
+        status = TERMINAL_ERROR_TX_BUFFER_OVERFLOW;
+        goto errors;
+    }
+    terminal_ctx[instance].tx_buffer[terminal_ctx[instance].tx_buffer_size++] = character;
+    terminal_ctx[instance].tx_buffer[terminal_ctx[instance].tx_buffer_size] = STRING_CHAR_NULL;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_tx_buffer_add_byte(uint8_t instance, uint8_t data) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Add both hexadecimal digits.
+    status = _TERMINAL_tx_buffer_add_character(instance, TERMINAL_HEXADECIMAL[(data >> 4) & 0x0F]);
+    if (status != TERMINAL_SUCCESS) goto errors;
+    status = _TERMINAL_tx_buffer_add_character(instance, TERMINAL_HEXADECIMAL[data & 0x0F]);
+    if (status != TERMINAL_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*** TERMINAL functions ***/
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, TERMINAL_rx_irq_cb_t rx_irq_callback) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    UNUSED(baud_rate);
+    terminal_ctx[instance].rx_irq_callback = rx_irq_callback;
+    terminal_ctx[instance].tx_buffer_size = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_close(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    terminal_ctx[instance].rx_irq_callback = NULL;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_enable_rx(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    // The remote node replies as soon as the receiver is enabled.
+    if (terminal_ctx[instance].bus_callback != NULL) {
+        terminal_ctx[instance].bus_callback(instance);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_disable_rx(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+    }
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_set_destination_address(uint8_t instance, uint8_t destination_address) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    terminal_ctx[instance].destination_address = destination_address;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_flush_tx_buffer(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    terminal_ctx[instance].tx_buffer_size = 0;
+    terminal_ctx[instance].tx_buffer[0] = STRING_CHAR_NULL;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_string(uint8_t instance, char_t* str) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameters.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    if (str == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy characters.
+    while ((*str) != STRING_CHAR_NULL) {
+        status = _TERMINAL_tx_buffer_add_character(instance, *(str++));
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_integer(uint8_t instance, int32_t value, STRING_format_t format, uint8_t print_prefix) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    char_t digits[10];
+    uint32_t absolute_value = (uint32_t) value;
+    uint8_t digit_count = 0;
+    uint8_t idx = 0;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    if (format == STRING_FORMAT_DECIMAL) {
+        // Print sign.
+        if (value < 0) {
+            status = _TERMINAL_tx_buffer_add_character(instance, '-');
+            if (status != TERMINAL_SUCCESS) goto errors;
+            absolute_value = (uint32_t) (-value);
+        }
+        // Compute digits in reverse order.
+        do {
+            digits[digit_count++] = (char_t) ('0' + (absolute_value % 10));
+            absolute_value /= 10;
+        }
+        while (absolute_value != 0);
+        for (idx = 0; idx < digit_count; idx++) {
+            status = _TERMINAL_tx_buffer_add_character(instance, digits[digit_count - 1 - idx]);
+            if (status != TERMINAL_SUCCESS) goto errors;
+        }
+    }
+    else {
+        // Hexadecimal values are printed with the minimum number of bytes.
+        if (print_prefix != 0) {
+            status = TERMINAL_tx_buffer_add_string(instance, "0x");
+            if (status != TERMINAL_SUCCESS) goto errors;
+        }
+        for (idx = 0; idx < 3; idx++) {
+            if ((absolute_value >> ((3 - idx) << 3)) != 0) break;
+        }
+        for (; idx < 4; idx++) {
+            status = _TERMINAL_tx_buffer_add_byte(instance, (uint8_t) ((absolute_value >> ((3 - idx) << 3)) & 0xFF));
+            if (status != TERMINAL_SUCCESS) goto errors;
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_byte_array(uint8_t instance, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    if (data == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (print_prefix != 0) {
+        status = TERMINAL_tx_buffer_add_string(instance, "0x");
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        status = _TERMINAL_tx_buffer_add_byte(instance, data[idx]);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_send_tx_buffer(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint32_t idx = 0;
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) {
+        status = TERMINAL_ERROR_INSTANCE;
+        goto errors;
+    }
+    // Record the frame on the simulated bus.
+    for (idx = 0; idx <= terminal_ctx[instance].tx_buffer_size; idx++) {
+        terminal_ctx[instance].sent_buffer[idx] = terminal_ctx[instance].tx_buffer[idx];
+    }
+    terminal_ctx[instance].sent_destination_address = terminal_ctx[instance].destination_address;
+errors:
+    return status;
+}
+
+/*** TERMINAL stub functions ***/
+
+/*******************************************************************/
+void TERMINAL_STUB_set_bus_callback(uint8_t instance, TERMINAL_bus_cb_t bus_callback) {
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) return;
+    terminal_ctx[instance].bus_callback = bus_callback;
+}
+
+/*******************************************************************/
+TERMINAL_rx_irq_cb_t TERMINAL_STUB_get_rx_irq_callback(uint8_t instance) {
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) return NULL;
+    return terminal_ctx[instance].rx_irq_callback;
+}
+
+/*******************************************************************/
+char_t* TERMINAL_STUB_get_sent_buffer(uint8_t instance, uint8_t* destination_address) {
+    // Check instance.
+    if (instance >= TERMINAL_INSTANCES_NUMBER) return NULL;
+    if (destination_address != NULL) {
+        (*destination_address) = terminal_ctx[instance].sent_destination_address;
+    }
+    return terminal_ctx[instance].sent_buffer;
+}
@@ -0,0 +1,686 @@
+/*
+ * una_at_bench.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_at.h"
+#include "una_at_hw.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ptrace.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "at.h"
+#include "strings.h"
+#include "terminal.h"
+#include "types.h"
+#include "una.h"
+
+/*** UNA AT BENCH local macros ***/
+
+#define UNA_AT_BENCH_BAUD_RATE              9600
+#define UNA_AT_BENCH_NODE_ADDRESS           0x20
+#define UNA_AT_BENCH_REMOTE_NODE_ADDRESS    0x21
+#define UNA_AT_BENCH_REG_ADDR               0x0A
+#define UNA_AT_BENCH_IRQ_READ_REG_ADDR      0x03
+#define UNA_AT_BENCH_REG_VALUE              0x1234ABCD
+#define UNA_AT_BENCH_REPLY_TIMEOUT_MS       100
+
+#define UNA_AT_BENCH_WRITE_COMMAND          "AT$W=0A,1234ABCD"
+#define UNA_AT_BENCH_READ_COMMAND           "AT$R=0A"
+#define UNA_AT_BENCH_IRQ_READ_COMMAND       "AT$R=03"
+#define UNA_AT_BENCH_REPLY_OK               "OK\r"
+#define UNA_AT_BENCH_REPLY_VALUE            "1234ABCD\rOK\r"
+
+#define UNA_AT_BENCH_STEPS_MAX              10000000
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_MODE_SLAVE))
+#define UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE   UNA_AT_GATEWAY_TERMINAL_INSTANCE
+#else
+#define UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE   UNA_AT_TERMINAL_INSTANCE
+#endif
+
+/*** UNA AT BENCH local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    void (*prepare)(void);
+    void (*run)(void);
+    uint8_t (*check)(void);
+} UNA_AT_BENCH_operation_t;
+
+/*******************************************************************/
+typedef struct {
+    uint32_t tick_ms;
+    UNA_AT_status_t status;
+    char_t* bus_reply;
+#ifdef UNA_AT_MODE_MASTER
+    UNA_access_parameters_t access_params;
+    UNA_access_status_t access_status;
+    uint32_t reg_value;
+#endif
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+    uint8_t* rx_dma_buffer;
+    uint32_t rx_dma_buffer_size;
+    uint32_t rx_dma_write_idx;
+    UNA_AT_HW_rx_dma_cb_t rx_dma_callback;
+#endif
+#ifdef UNA_AT_MODE_SLAVE
+    UNA_node_address_t destination_address;
+    uint8_t written_reg_addr;
+    uint32_t written_reg_value;
+    uint32_t written_reg_mask;
+#endif
+#ifdef UNA_AT_IRQ_READ
+    char_t irq_reply[UNA_AT_REPLY_BUFFER_SIZE_BYTES];
+#endif
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    PARSER_context_t* parser_ptr;
+#endif
+} UNA_AT_BENCH_context_t;
+
+/*** UNA AT BENCH local global variables ***/
+
+static UNA_AT_BENCH_context_t una_at_bench_ctx;
+
+/*** UNA AT BENCH local functions ***/
+
+/*******************************************************************/
+static void _UNA_AT_BENCH_marker(void) {
+    // Stop the measured process so that the tracer can start or stop counting.
+    raise(SIGSTOP);
+}
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_bus_callback(uint8_t instance) {
+    // Local variables.
+    char_t* reply = una_at_bench_ctx.bus_reply;
+#ifndef UNA_AT_RX_DMA
+    TERMINAL_rx_irq_cb_t rx_irq_callback = TERMINAL_STUB_get_rx_irq_callback(instance);
+#endif
+    // Each command is answered once.
+    una_at_bench_ctx.bus_reply = NULL;
+    if (reply == NULL) return;
+#ifdef UNA_AT_RX_DMA
+    UNUSED(instance);
+    // Bytes are written by the DMA and the idle line interrupt occurs at the end of the reply.
+    while ((*reply) != STRING_CHAR_NULL) {
+        una_at_bench_ctx.rx_dma_buffer[una_at_bench_ctx.rx_dma_write_idx] = (uint8_t) (*(reply++));
+        una_at_bench_ctx.rx_dma_write_idx = ((una_at_bench_ctx.rx_dma_write_idx + 1) % una_at_bench_ctx.rx_dma_buffer_size);
+    }
+    una_at_bench_ctx.rx_dma_callback(una_at_bench_ctx.rx_dma_write_idx, 0);
+#else
+    if (rx_irq_callback == NULL) return;
+    while ((*reply) != STRING_CHAR_NULL) {
+        rx_irq_callback((uint8_t) (*(reply++)));
+    }
+#endif
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static AT_status_t _UNA_AT_BENCH_write_register_callback(uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    una_at_bench_ctx.written_reg_addr = reg_addr;
+    una_at_bench_ctx.written_reg_value = reg_value;
+    una_at_bench_ctx.written_reg_mask = reg_mask;
+    return AT_SUCCESS;
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static AT_status_t _UNA_AT_BENCH_read_register_callback(uint8_t reg_addr, uint32_t* reg_value) {
+    UNUSED(reg_addr);
+    (*reg_value) = UNA_AT_BENCH_REG_VALUE;
+    return AT_SUCCESS;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_NOTIFICATIONS))
+/*******************************************************************/
+static void _UNA_AT_BENCH_notification_callback(UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value) {
+    UNUSED(node_addr);
+    UNUSED(reg_addr);
+    UNUSED(reg_value);
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static void _UNA_AT_BENCH_baud_rate_callback(uint32_t baud_rate) {
+    UNUSED(baud_rate);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_access(UNA_reply_type_t reply_type, char_t* bus_reply) {
+    una_at_bench_ctx.access_params.node_addr = UNA_AT_BENCH_REMOTE_NODE_ADDRESS;
+    una_at_bench_ctx.access_params.reg_addr = UNA_AT_BENCH_REG_ADDR;
+    una_at_bench_ctx.access_params.reply_params.type = reply_type;
+    una_at_bench_ctx.access_params.reply_params.timeout_ms = UNA_AT_BENCH_REPLY_TIMEOUT_MS;
+    una_at_bench_ctx.reg_value = 0;
+    una_at_bench_ctx.bus_reply = bus_reply;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_frame(char_t* command) {
+    // Local variables.
+    UNA_node_address_t destination_address = 0;
+    char_t* sent = TERMINAL_STUB_get_sent_buffer(UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE, &destination_address);
+    // Check the last frame sent on the bus.
+    if (destination_address != UNA_AT_BENCH_REMOTE_NODE_ADDRESS) return 0;
+    if ((strncmp(sent, command, strlen(command)) != 0) || (strcmp(&(sent[strlen(command)]), "\r") != 0)) return 0;
+    return 1;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_access(char_t* command) {
+    if ((una_at_bench_ctx.status != UNA_AT_SUCCESS) || (una_at_bench_ctx.access_status.flags != 0)) return 0;
+    return _UNA_AT_BENCH_check_frame(command);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_write_command(void) {
+    _UNA_AT_BENCH_prepare_access(UNA_REPLY_TYPE_NONE, NULL);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_write_register(void) {
+    _UNA_AT_BENCH_prepare_access(UNA_REPLY_TYPE_OK, UNA_AT_BENCH_REPLY_OK);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_run_write_register(void) {
+    una_at_bench_ctx.status = UNA_AT_write_register(&una_at_bench_ctx.access_params, UNA_AT_BENCH_REG_VALUE, UNA_REGISTER_MASK_ALL, &una_at_bench_ctx.access_status);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_write_register(void) {
+    return _UNA_AT_BENCH_check_access(UNA_AT_BENCH_WRITE_COMMAND);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_read_command(void) {
+    _UNA_AT_BENCH_prepare_access(UNA_REPLY_TYPE_NONE, NULL);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_read_register(void) {
+    _UNA_AT_BENCH_prepare_access(UNA_REPLY_TYPE_VALUE, UNA_AT_BENCH_REPLY_VALUE);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static void _UNA_AT_BENCH_run_read_register(void) {
+    una_at_bench_ctx.status = UNA_AT_read_register(&una_at_bench_ctx.access_params, &una_at_bench_ctx.reg_value, &una_at_bench_ctx.access_status);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_read_command(void) {
+    return _UNA_AT_BENCH_check_access(UNA_AT_BENCH_READ_COMMAND);
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_read_register(void) {
+    if (una_at_bench_ctx.reg_value != UNA_AT_BENCH_REG_VALUE) return 0;
+    return _UNA_AT_BENCH_check_access(UNA_AT_BENCH_READ_COMMAND);
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && !(defined UNA_AT_RX_DMA))
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_rx_byte(void) {
+    una_at_bench_ctx.bus_reply = "1";
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && !(defined UNA_AT_RX_DMA))
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_rx_line_end(void) {
+    // Receive the line content before the measured ending marker.
+    una_at_bench_ctx.bus_reply = "234ABCD";
+    _UNA_AT_BENCH_bus_callback(UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE);
+    una_at_bench_ctx.bus_reply = "\r";
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && !(defined UNA_AT_RX_DMA))
+/*******************************************************************/
+static void _UNA_AT_BENCH_run_rx(void) {
+    // Same entry point as the terminal reception interrupt.
+    _UNA_AT_BENCH_bus_callback(UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE);
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && !(defined UNA_AT_RX_DMA))
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_rx(void) {
+    return ((TERMINAL_STUB_get_rx_irq_callback(UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE) != NULL) ? 1 : 0);
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_process(char_t* command, UNA_node_address_t destination_address, char_t* bus_reply) {
+    // Flush previous replies.
+    AT_STUB_get_sent_replies();
+    una_at_bench_ctx.written_reg_addr = 0;
+    una_at_bench_ctx.written_reg_value = 0;
+    una_at_bench_ctx.written_reg_mask = 0;
+    una_at_bench_ctx.destination_address = destination_address;
+    una_at_bench_ctx.bus_reply = bus_reply;
+    // Receive command.
+    AT_STUB_receive_command(command);
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_write_process(void) {
+    _UNA_AT_BENCH_prepare_process(UNA_AT_BENCH_WRITE_COMMAND, UNA_AT_BENCH_NODE_ADDRESS, NULL);
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_read_process(void) {
+    _UNA_AT_BENCH_prepare_process(UNA_AT_BENCH_READ_COMMAND, UNA_AT_BENCH_NODE_ADDRESS, NULL);
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static void _UNA_AT_BENCH_run_process(void) {
+    una_at_bench_ctx.status = UNA_AT_process();
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_write_process(void) {
+    if (una_at_bench_ctx.status != UNA_AT_SUCCESS) return 0;
+    if ((una_at_bench_ctx.written_reg_addr != UNA_AT_BENCH_REG_ADDR) || (una_at_bench_ctx.written_reg_value != UNA_AT_BENCH_REG_VALUE) || (una_at_bench_ctx.written_reg_mask != UNA_REGISTER_MASK_ALL)) return 0;
+    return ((strcmp(AT_STUB_get_sent_replies(), UNA_AT_BENCH_REPLY_OK) == 0) ? 1 : 0);
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_read_process(void) {
+    if (una_at_bench_ctx.status != UNA_AT_SUCCESS) return 0;
+    return ((strcmp(AT_STUB_get_sent_replies(), UNA_AT_BENCH_REPLY_VALUE) == 0) ? 1 : 0);
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_irq_read(void) {
+    una_at_bench_ctx.irq_reply[0] = STRING_CHAR_NULL;
+    una_at_bench_ctx.destination_address = UNA_AT_BENCH_NODE_ADDRESS;
+    UNA_AT_set_irq_read_register(UNA_AT_BENCH_IRQ_READ_REG_ADDR, UNA_AT_BENCH_REG_VALUE);
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+static void _UNA_AT_BENCH_run_irq_read(void) {
+    // Local variables.
+    char_t* command = UNA_AT_BENCH_IRQ_READ_COMMAND "\r";
+    // Same entry point as the terminal reception interrupt.
+    while ((*command) != STRING_CHAR_NULL) {
+        UNA_AT_irq_read_rx_callback((uint8_t) (*(command++)));
+    }
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_irq_read(void) {
+    if (strcmp(una_at_bench_ctx.irq_reply, UNA_AT_BENCH_REPLY_VALUE) != 0) return 0;
+    // The deferred processing of the same line must not reply again.
+    _UNA_AT_BENCH_prepare_process(UNA_AT_BENCH_IRQ_READ_COMMAND, UNA_AT_BENCH_NODE_ADDRESS, NULL);
+    if (UNA_AT_process() != UNA_AT_SUCCESS) return 0;
+    AT_STUB_get_sent_replies();
+    return 1;
+}
+#endif
+
+#ifdef UNA_AT_GATEWAY
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_forward_write(void) {
+    _UNA_AT_BENCH_prepare_process(UNA_AT_BENCH_WRITE_COMMAND, UNA_AT_BENCH_REMOTE_NODE_ADDRESS, UNA_AT_BENCH_REPLY_OK);
+}
+#endif
+
+#ifdef UNA_AT_GATEWAY
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_forward_write(void) {
+    if ((una_at_bench_ctx.status != UNA_AT_SUCCESS) || (_UNA_AT_BENCH_check_frame(UNA_AT_BENCH_WRITE_COMMAND) == 0)) return 0;
+    return ((strcmp(AT_STUB_get_sent_replies(), UNA_AT_BENCH_REPLY_OK) == 0) ? 1 : 0);
+}
+#endif
+
+#ifdef UNA_AT_GATEWAY
+/*******************************************************************/
+static void _UNA_AT_BENCH_prepare_forward_read(void) {
+    _UNA_AT_BENCH_prepare_process(UNA_AT_BENCH_READ_COMMAND, UNA_AT_BENCH_REMOTE_NODE_ADDRESS, UNA_AT_BENCH_REPLY_VALUE);
+}
+#endif
+
+#ifdef UNA_AT_GATEWAY
+/*******************************************************************/
+static uint8_t _UNA_AT_BENCH_check_forward_read(void) {
+    if ((una_at_bench_ctx.status != UNA_AT_SUCCESS) || (_UNA_AT_BENCH_check_frame(UNA_AT_BENCH_READ_COMMAND) == 0)) return 0;
+    return ((strcmp(AT_STUB_get_sent_replies(), UNA_AT_BENCH_REPLY_VALUE) == 0) ? 1 : 0);
+}
+#endif
+
+/*** UNA AT BENCH operations list ***/
+
+static const UNA_AT_BENCH_operation_t UNA_AT_BENCH_OPERATIONS[] = {
+#ifdef UNA_AT_MODE_MASTER
+    { "master_write_command", &_UNA_AT_BENCH_prepare_write_command, &_UNA_AT_BENCH_run_write_register, &_UNA_AT_BENCH_check_write_register },
+    { "master_read_command", &_UNA_AT_BENCH_prepare_read_command, &_UNA_AT_BENCH_run_read_register, &_UNA_AT_BENCH_check_read_command },
+#ifndef UNA_AT_RX_DMA
+    { "master_rx_byte", &_UNA_AT_BENCH_prepare_rx_byte, &_UNA_AT_BENCH_run_rx, &_UNA_AT_BENCH_check_rx },
+    { "master_rx_line_end", &_UNA_AT_BENCH_prepare_rx_line_end, &_UNA_AT_BENCH_run_rx, &_UNA_AT_BENCH_check_rx },
+#endif
+    { "master_write_register", &_UNA_AT_BENCH_prepare_write_register, &_UNA_AT_BENCH_run_write_register, &_UNA_AT_BENCH_check_write_register },
+    { "master_read_register", &_UNA_AT_BENCH_prepare_read_register, &_UNA_AT_BENCH_run_read_register, &_UNA_AT_BENCH_check_read_register },
+#endif
+#ifdef UNA_AT_MODE_SLAVE
+    { "slave_write_process", &_UNA_AT_BENCH_prepare_write_process, &_UNA_AT_BENCH_run_process, &_UNA_AT_BENCH_check_write_process },
+    { "slave_read_process", &_UNA_AT_BENCH_prepare_read_process, &_UNA_AT_BENCH_run_process, &_UNA_AT_BENCH_check_read_process },
+#ifdef UNA_AT_IRQ_READ
+    { "slave_irq_read", &_UNA_AT_BENCH_prepare_irq_read, &_UNA_AT_BENCH_run_irq_read, &_UNA_AT_BENCH_check_irq_read },
+#endif
+#endif
+#ifdef UNA_AT_GATEWAY
+    { "gateway_forward_write", &_UNA_AT_BENCH_prepare_forward_write, &_UNA_AT_BENCH_run_process, &_UNA_AT_BENCH_check_forward_write },
+    { "gateway_forward_read", &_UNA_AT_BENCH_prepare_forward_read, &_UNA_AT_BENCH_run_process, &_UNA_AT_BENCH_check_forward_read },
+#endif
+};
+
+#define UNA_AT_BENCH_OPERATIONS_NUMBER      (sizeof(UNA_AT_BENCH_OPERATIONS) / sizeof(UNA_AT_BENCH_operation_t))
+
+/*** UNA AT BENCH local measurement functions ***/
+
+/*******************************************************************/
+static void _UNA_AT_BENCH_child(void) {
+    // Local variables.
+    UNA_AT_configuration_t configuration;
+    uint32_t idx = 0;
+    // Wait for the tracer.
+    if (ptrace(PTRACE_TRACEME, 0, NULL, NULL) != 0) _exit(1);
+    _UNA_AT_BENCH_marker();
+    // Init library.
+    memset(&configuration, 0, sizeof(UNA_AT_configuration_t));
+#ifdef UNA_AT_MODE_MASTER
+    configuration.baud_rate = UNA_AT_BENCH_BAUD_RATE;
+#ifdef UNA_AT_NOTIFICATIONS
+    configuration.notification_callback = &_UNA_AT_BENCH_notification_callback;
+#endif
+#endif
+#ifdef UNA_AT_MODE_SLAVE
+    configuration.write_register_callback = &_UNA_AT_BENCH_write_register_callback;
+    configuration.read_register_callback = &_UNA_AT_BENCH_read_register_callback;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    configuration.parser_context_ptr = &una_at_bench_ctx.parser_ptr;
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    configuration.default_baud_rate = UNA_AT_BENCH_BAUD_RATE;
+    configuration.baud_rate_callback = &_UNA_AT_BENCH_baud_rate_callback;
+#endif
+#ifdef UNA_AT_GATEWAY
+    configuration.node_addr = UNA_AT_BENCH_NODE_ADDRESS;
+#endif
+    una_at_bench_ctx.destination_address = UNA_AT_BENCH_NODE_ADDRESS;
+#endif
+    if (UNA_AT_init(&configuration) != UNA_AT_SUCCESS) _exit(1);
+#ifdef UNA_AT_MODE_MASTER
+    TERMINAL_STUB_set_bus_callback(UNA_AT_BENCH_MASTER_TERMINAL_INSTANCE, &_UNA_AT_BENCH_bus_callback);
+#endif
+    // Empty measurement to calibrate the markers overhead.
+    _UNA_AT_BENCH_marker();
+    _UNA_AT_BENCH_marker();
+    // Measure operations.
+    for (idx = 0; idx < UNA_AT_BENCH_OPERATIONS_NUMBER; idx++) {
+        UNA_AT_BENCH_OPERATIONS[idx].prepare();
+        _UNA_AT_BENCH_marker();
+        UNA_AT_BENCH_OPERATIONS[idx].run();
+        _UNA_AT_BENCH_marker();
+        // Exit code gives the failed operation.
+        if (UNA_AT_BENCH_OPERATIONS[idx].check() == 0) _exit((int) (idx + 2));
+    }
+    _exit(0);
+}
+
+/*******************************************************************/
+static int _UNA_AT_BENCH_wait_marker(pid_t pid) {
+    // Local variables.
+    int wait_status = 0;
+    // Run until the next marker.
+    if (ptrace(PTRACE_CONT, pid, NULL, NULL) != 0) return -1;
+    if (waitpid(pid, &wait_status, 0) < 0) return -1;
+    if ((WIFSTOPPED(wait_status) == 0) || (WSTOPSIG(wait_status) != SIGSTOP)) return ((WIFEXITED(wait_status) != 0) ? WEXITSTATUS(wait_status) : -1);
+    return 0;
+}
+
+/*******************************************************************/
+static int _UNA_AT_BENCH_count_instructions(pid_t pid, uint64_t* instructions) {
+    // Local variables.
+    int wait_status = 0;
+    // Single-step until the next marker.
+    (*instructions) = 0;
+    while ((*instructions) < UNA_AT_BENCH_STEPS_MAX) {
+        if (ptrace(PTRACE_SINGLESTEP, pid, NULL, NULL) != 0) return -1;
+        if (waitpid(pid, &wait_status, 0) < 0) return -1;
+        if (WIFSTOPPED(wait_status) == 0) return ((WIFEXITED(wait_status) != 0) ? WEXITSTATUS(wait_status) : -1);
+        if (WSTOPSIG(wait_status) == SIGSTOP) return 0;
+        if (WSTOPSIG(wait_status) != SIGTRAP) return -1;
+        (*instructions)++;
+    }
+    return -1;
+}
+
+/*******************************************************************/
+static int _UNA_AT_BENCH_get_budget(int argc, char* argv[], const char_t* name, uint64_t* budget) {
+    // Local variables.
+    size_t name_size = strlen(name);
+    int idx = 0;
+    // Budgets are given as <operation>=<instructions>.
+    for (idx = 1; idx < argc; idx++) {
+        if ((strncmp(argv[idx], name, name_size) == 0) && (argv[idx][name_size] == '=')) {
+            (*budget) = strtoull(&(argv[idx][name_size + 1]), NULL, 0);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/*** UNA AT BENCH functions ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    uint64_t overhead = 0;
+    uint64_t instructions[UNA_AT_BENCH_OPERATIONS_NUMBER];
+    uint64_t budget = 0;
+    int error_count = 0;
+    int wait_status = 0;
+    int status = 0;
+    pid_t pid = 0;
+    uint32_t idx = 0;
+    uint32_t operation_idx = 0;
+    // Keep the report and the errors in order.
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    // Check that each budget matches an operation of this configuration.
+    for (idx = 1; idx < (uint32_t) argc; idx++) {
+        for (operation_idx = 0; operation_idx < UNA_AT_BENCH_OPERATIONS_NUMBER; operation_idx++) {
+            if (_UNA_AT_BENCH_get_budget(2, &(argv[idx - 1]), UNA_AT_BENCH_OPERATIONS[operation_idx].name, &budget) == 0) break;
+        }
+        if (operation_idx >= UNA_AT_BENCH_OPERATIONS_NUMBER) {
+            fprintf(stderr, "una-at benchmark: unknown operation in budget %s\n", argv[idx]);
+            error_count++;
+        }
+    }
+    // Start measured process.
+    pid = fork();
+    if (pid < 0) {
+        perror("una-at benchmark: fork");
+        return 1;
+    }
+    if (pid == 0) {
+        _UNA_AT_BENCH_child();
+    }
+    if ((waitpid(pid, &wait_status, 0) < 0) || (WIFSTOPPED(wait_status) == 0)) {
+        fprintf(stderr, "una-at benchmark: tracing not available\n");
+        return 1;
+    }
+    // Calibrate markers overhead.
+    status = _UNA_AT_BENCH_wait_marker(pid);
+    if (status == 0) {
+        status = _UNA_AT_BENCH_count_instructions(pid, &overhead);
+    }
+    if (status != 0) {
+        fprintf(stderr, "una-at benchmark: library initialization failed\n");
+        kill(pid, SIGKILL);
+        return 1;
+    }
+    // Measure operations.
+    for (idx = 0; idx < UNA_AT_BENCH_OPERATIONS_NUMBER; idx++) {
+        status = _UNA_AT_BENCH_wait_marker(pid);
+        if (status == 0) {
+            status = _UNA_AT_BENCH_count_instructions(pid, &(instructions[idx]));
+        }
+        if (status != 0) {
+            // The exit code gives the operation which failed its functional check.
+            if (status >= 2) {
+                fprintf(stderr, "una-at benchmark: %s returned an unexpected result\n", UNA_AT_BENCH_OPERATIONS[status - 2].name);
+            }
+            else {
+                fprintf(stderr, "una-at benchmark: %s measurement failed\n", UNA_AT_BENCH_OPERATIONS[idx].name);
+            }
+            kill(pid, SIGKILL);
+            return 1;
+        }
+        instructions[idx] = (instructions[idx] > overhead) ? (instructions[idx] - overhead) : 0;
+    }
+    // Let the last functional check complete.
+    ptrace(PTRACE_CONT, pid, NULL, NULL);
+    if ((waitpid(pid, &wait_status, 0) < 0) || (WIFEXITED(wait_status) == 0) || (WEXITSTATUS(wait_status) != 0)) {
+        fprintf(stderr, "una-at benchmark: %s returned an unexpected result\n", UNA_AT_BENCH_OPERATIONS[UNA_AT_BENCH_OPERATIONS_NUMBER - 1].name);
+        return 1;
+    }
+    // Report and check budgets (0 to only report the instructions count).
+    for (idx = 0; idx < UNA_AT_BENCH_OPERATIONS_NUMBER; idx++) {
+        if (_UNA_AT_BENCH_get_budget(argc, argv, UNA_AT_BENCH_OPERATIONS[idx].name, &budget) != 0) {
+            printf("una-at benchmark: %s=%llu instructions (no budget)\n", UNA_AT_BENCH_OPERATIONS[idx].name, (unsigned long long) instructions[idx]);
+            fprintf(stderr, "una-at benchmark: %s budget is missing\n", UNA_AT_BENCH_OPERATIONS[idx].name);
+            error_count++;
+            continue;
+        }
+        printf("una-at benchmark: %s=%llu instructions (budget %llu)\n", UNA_AT_BENCH_OPERATIONS[idx].name, (unsigned long long) instructions[idx], (unsigned long long) budget);
+        if ((budget > 0) && (instructions[idx] > budget)) {
+            fprintf(stderr, "una-at benchmark: %s budget exceeded by %llu instructions\n", UNA_AT_BENCH_OPERATIONS[idx].name, (unsigned long long) (instructions[idx] - budget));
+            error_count++;
+        }
+    }
+    return ((error_count == 0) ? 0 : 1);
+}
+
+/*** UNA AT HW functions ***/
+
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_delay_milliseconds(uint32_t delay_ms) {
+    // Simulated time only elapses while waiting.
+    una_at_bench_ctx.tick_ms += delay_ms;
+    return UNA_AT_SUCCESS;
+}
+
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_get_tick_ms(uint32_t* tick_ms) {
+    (*tick_ms) = una_at_bench_ctx.tick_ms;
+    return UNA_AT_SUCCESS;
+}
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_rx_dma_start(uint8_t* rx_buffer, uint32_t rx_buffer_size_bytes, UNA_AT_HW_rx_dma_cb_t rx_dma_callback) {
+    una_at_bench_ctx.rx_dma_buffer = rx_buffer;
+    una_at_bench_ctx.rx_dma_buffer_size = rx_buffer_size_bytes;
+    una_at_bench_ctx.rx_dma_write_idx = 0;
+    una_at_bench_ctx.rx_dma_callback = rx_dma_callback;
+    return UNA_AT_SUCCESS;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_rx_dma_stop(void) {
+    una_at_bench_ctx.rx_dma_callback = NULL;
+    return UNA_AT_SUCCESS;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_GATEWAY))))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_get_destination_address(UNA_node_address_t* destination_address) {
+    (*destination_address) = una_at_bench_ctx.destination_address;
+    return UNA_AT_SUCCESS;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_IRQ_READ)))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_set_reply_mute(uint8_t mute_flag) {
+    UNUSED(mute_flag);
+    return UNA_AT_SUCCESS;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_HW_send_irq_reply(uint8_t* reply, uint32_t reply_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Record the reply sent from the reception context.
+    for (idx = 0; (idx < reply_size_bytes) && (idx < (UNA_AT_REPLY_BUFFER_SIZE_BYTES - 1)); idx++) {
+        una_at_bench_ctx.irq_reply[idx] = (char_t) reply[idx];
+    }
+    una_at_bench_ctx.irq_reply[idx] = STRING_CHAR_NULL;
+    return UNA_AT_SUCCESS;
+}
+#endif
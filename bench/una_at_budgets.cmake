@@ -0,0 +1,124 @@
+#
+# una_at_budgets.cmake
+#
+#  Created on: 19 oct. 2026
+#      Author: Ludo
+#
+
+# Reference configurations built by the benchmark target, flags which are not listed keep their default value.
+# Budgets are host measurements (x86-64, gcc -Os) of the library archive and of the operations listed in una_at_bench.c, with a 10% margin.
+# They must be updated when a change is validated, and can be set to 0 to only report a value.
+
+set(UNA_AT_BENCH_CONFIGURATIONS master slave master_full slave_full gateway)
+
+# Flags common to all configurations.
+set(UNA_AT_BENCH_COMMON_FLAGS
+    UNA_AT_TERMINAL_INSTANCE=0
+    UNA_AT_SCAN_REGISTER_MASK_NODE_ADDRESS=0x0000007F
+    UNA_AT_SCAN_REGISTER_MASK_BOARD_ID=0x00FFFF00
+    UNA_AT_SCAN_REGISTER_TIMEOUT_MS=100
+    UNA_AT_BAUD_RATE_REGISTER_MASK=0xFFFF0000
+    EMBEDDED_UTILS_HW_INTERFACE_ERROR_BASE_LAST=0
+    EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER=2
+)
+
+# Master mode with default features.
+set(UNA_AT_BENCH_master_FLAGS
+    UNA_AT_MODE_MASTER=ON
+    UNA_AT_MODE_SLAVE=OFF
+)
+set(UNA_AT_BENCH_master_FLASH_BUDGET_BYTES 2991)
+set(UNA_AT_BENCH_master_RAM_BUDGET_BYTES 713)
+set(UNA_AT_BENCH_master_INSTRUCTIONS_BUDGETS
+    master_write_command=4336
+    master_read_command=3947
+    master_rx_byte=65
+    master_rx_line_end=68
+    master_write_register=4622
+    master_read_register=4699
+)
+
+# Slave mode with default features.
+set(UNA_AT_BENCH_slave_FLAGS
+    UNA_AT_MODE_MASTER=OFF
+    UNA_AT_MODE_SLAVE=ON
+)
+set(UNA_AT_BENCH_slave_FLASH_BUDGET_BYTES 1157)
+set(UNA_AT_BENCH_slave_RAM_BUDGET_BYTES 124)
+set(UNA_AT_BENCH_slave_INSTRUCTIONS_BUDGETS
+    slave_write_process=692
+    slave_read_process=703
+)
+
+# Master mode with all optional features.
+set(UNA_AT_BENCH_master_full_FLAGS
+    UNA_AT_MODE_MASTER=ON
+    UNA_AT_MODE_SLAVE=OFF
+    UNA_AT_BROADCAST_NODE_ADDRESS=0x7F
+    UNA_AT_RX_DMA=ON
+    UNA_AT_POLLING=ON
+    UNA_AT_REPLY_STREAMING=ON
+    UNA_AT_BATCH=ON
+    UNA_AT_WRITE_READ=ON
+    UNA_AT_COMPARE_AND_SWAP=ON
+    UNA_AT_BLOCK_TRANSFER=ON
+    UNA_AT_NOTIFICATIONS=ON
+    UNA_AT_DIRTY_REGISTERS=ON
+    UNA_AT_SNAPSHOT=ON
+    UNA_AT_CONDITIONAL_WAIT=ON
+    UNA_AT_BAUD_RATE_NEGOTIATION=ON
+)
+set(UNA_AT_BENCH_master_full_FLASH_BUDGET_BYTES 11784)
+set(UNA_AT_BENCH_master_full_RAM_BUDGET_BYTES 1144)
+set(UNA_AT_BENCH_master_full_INSTRUCTIONS_BUDGETS
+    master_write_command=4391
+    master_read_command=3994
+    master_write_register=4757
+    master_read_register=4996
+)
+
+# Slave mode with all optional features.
+set(UNA_AT_BENCH_slave_full_FLAGS
+    UNA_AT_MODE_MASTER=OFF
+    UNA_AT_MODE_SLAVE=ON
+    UNA_AT_BROADCAST_NODE_ADDRESS=0x7F
+    UNA_AT_CUSTOM_COMMANDS=ON
+    UNA_AT_IRQ_READ=ON
+    UNA_AT_WRITE_READ=ON
+    UNA_AT_COMPARE_AND_SWAP=ON
+    UNA_AT_BLOCK_TRANSFER=ON
+    UNA_AT_NOTIFICATIONS=ON
+    UNA_AT_DIRTY_REGISTERS=ON
+    UNA_AT_SNAPSHOT=ON
+    UNA_AT_CONDITIONAL_WAIT=ON
+    UNA_AT_BAUD_RATE_NEGOTIATION=ON
+)
+set(UNA_AT_BENCH_slave_full_FLASH_BUDGET_BYTES 7665)
+set(UNA_AT_BENCH_slave_full_RAM_BUDGET_BYTES 1118)
+set(UNA_AT_BENCH_slave_full_INSTRUCTIONS_BUDGETS
+    slave_write_process=873
+    slave_read_process=907
+    slave_irq_read=621
+)
+
+# Gateway between two buses.
+set(UNA_AT_BENCH_gateway_FLAGS
+    UNA_AT_MODE_MASTER=ON
+    UNA_AT_MODE_SLAVE=ON
+    UNA_AT_GATEWAY=ON
+    UNA_AT_GATEWAY_TERMINAL_INSTANCE=1
+)
+set(UNA_AT_BENCH_gateway_FLASH_BUDGET_BYTES 5157)
+set(UNA_AT_BENCH_gateway_RAM_BUDGET_BYTES 933)
+set(UNA_AT_BENCH_gateway_INSTRUCTIONS_BUDGETS
+    master_write_command=4360
+    master_read_command=3968
+    master_rx_byte=65
+    master_rx_line_end=68
+    master_write_register=4652
+    master_read_register=4723
+    slave_write_process=713
+    slave_read_process=735
+    gateway_forward_write=5365
+    gateway_forward_read=5554
+)
@@ -0,0 +1,49 @@
+#
+# una_at_footprint.cmake
+#
+#  Created on: 19 oct. 2026
+#      Author: Ludo
+#
+
+# Script mode: cmake -DSIZE_UTIL=<path> -DARCHIVE=<path> [-DFLASH_BUDGET_BYTES=<value>] [-DRAM_BUDGET_BYTES=<value>] -P una_at_footprint.cmake
+# Flash is computed as text + data and RAM as data + bss. A budget set to 0 only reports the footprint.
+
+if((NOT DEFINED SIZE_UTIL) OR (NOT DEFINED ARCHIVE))
+    message(FATAL_ERROR "una-at footprint: SIZE_UTIL and ARCHIVE must be defined")
+endif()
+if(NOT DEFINED FLASH_BUDGET_BYTES)
+    set(FLASH_BUDGET_BYTES 0)
+endif()
+if(NOT DEFINED RAM_BUDGET_BYTES)
+    set(RAM_BUDGET_BYTES 0)
+endif()
+
+# Read archive size in Berkeley format.
+execute_process(
+    COMMAND ${SIZE_UTIL} -B -t ${ARCHIVE}
+    OUTPUT_VARIABLE SIZE_OUTPUT
+    RESULT_VARIABLE SIZE_RESULT
+)
+if(NOT SIZE_RESULT EQUAL 0)
+    message(FATAL_ERROR "una-at footprint: ${SIZE_UTIL} failed on ${ARCHIVE}")
+endif()
+message(STATUS "\n${SIZE_OUTPUT}")
+
+# Parse totals line.
+string(REGEX MATCH "([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9a-fA-F]+[ \t]+\\(TOTALS\\)" TOTALS_LINE "${SIZE_OUTPUT}")
+if(NOT TOTALS_LINE)
+    message(FATAL_ERROR "una-at footprint: totals not found in size output")
+endif()
+math(EXPR FLASH_BYTES "${CMAKE_MATCH_1} + ${CMAKE_MATCH_2}")
+math(EXPR RAM_BYTES "${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}")
+message(STATUS "una-at footprint: flash=${FLASH_BYTES} bytes (budget ${FLASH_BUDGET_BYTES}), RAM=${RAM_BYTES} bytes (budget ${RAM_BUDGET_BYTES})")
+
+# Check budgets.
+if((FLASH_BUDGET_BYTES GREATER 0) AND (FLASH_BYTES GREATER FLASH_BUDGET_BYTES))
+    math(EXPR EXCESS_BYTES "${FLASH_BYTES} - ${FLASH_BUDGET_BYTES}")
+    message(FATAL_ERROR "una-at footprint: flash budget exceeded by ${EXCESS_BYTES} bytes")
+endif()
+if((RAM_BUDGET_BYTES GREATER 0) AND (RAM_BYTES GREATER RAM_BUDGET_BYTES))
+    math(EXPR EXCESS_BYTES "${RAM_BYTES} - ${RAM_BUDGET_BYTES}")
+    message(FATAL_ERROR "una-at footprint: RAM budget exceeded by ${EXCESS_BYTES} bytes")
+endif()
@@ -28,6 +28,10 @@ typedef enum {
     UNA_AT_SUCCESS = 0,
     UNA_AT_ERROR_NULL_PARAMETER,
     UNA_AT_ERROR_REPLY_TYPE,
+    UNA_AT_ERROR_CHUNK_SIZE,
+    UNA_AT_ERROR_NOTIFICATION_QUEUE_FULL,
+    UNA_AT_ERROR_WAIT_DURATION,
+    UNA_AT_ERROR_CUSTOM_COMMANDS_FULL,
     // Low level drivers errors.
     UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED,
     UNA_AT_ERROR_BASE_DELAY = ERROR_BASE_STEP,
@@ -39,6 +43,75 @@ typedef enum {
 
 #ifndef UNA_AT_DISABLE
 
+/*** UNA AT macros ***/
+
+#define UNA_AT_REPLY_BUFFER_SIZE_BYTES      128
+
+#ifdef UNA_AT_BLOCK_TRANSFER
+// Chunk line (offset, data with 2 characters per byte and 16-bits CRC) must fit in a null-terminated reply buffer.
+#define UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES   ((UNA_AT_REPLY_BUFFER_SIZE_BYTES - 1 - (UNA_REGISTER_SIZE_BYTES << 1) - 2 - 4) >> 1)
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_REPLY_STREAMING))
+/*!******************************************************************
+ * \fn UNA_AT_reply_line_cb_t
+ * \brief Command reply line reception callback.
+ *******************************************************************/
+typedef void (*UNA_AT_reply_line_cb_t)(char_t* line, uint32_t line_size);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_NOTIFICATIONS))
+/*!******************************************************************
+ * \fn UNA_AT_notification_cb_t
+ * \brief Node notification reception callback.
+ *******************************************************************/
+typedef void (*UNA_AT_notification_cb_t)(UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
+/*!******************************************************************
+ * \fn UNA_AT_polling_entry_t
+ * \brief UNA AT polling table entry.
+ *******************************************************************/
+typedef struct {
+    // Configuration.
+    UNA_node_address_t node_addr;
+    uint8_t reg_addr;
+    uint8_t priority;
+    uint32_t period_ms;
+    uint32_t timeout_ms;
+    // Results.
+    uint32_t reg_value;
+    UNA_access_status_t access_status;
+    uint32_t deadline_miss_count;
+    // Scheduler state.
+    uint32_t release_ms;
+} UNA_AT_polling_entry_t;
+
+/*!******************************************************************
+ * \fn UNA_AT_polling_cb_t
+ * \brief Polling access completion callback.
+ *******************************************************************/
+typedef void (*UNA_AT_polling_cb_t)(UNA_AT_polling_entry_t* entry);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BATCH))
+/*!******************************************************************
+ * \fn UNA_AT_batch_operation_t
+ * \brief UNA AT batch operation descriptor.
+ *******************************************************************/
+typedef struct {
+    // Configuration.
+    UNA_access_type_t type;
+    UNA_access_parameters_t access_params;
+    uint32_t reg_mask;
+    // Value to write (write operation) or read value (read operation).
+    uint32_t reg_value;
+    // Result.
+    UNA_access_status_t access_status;
+} UNA_AT_batch_operation_t;
+#endif
+
 #ifdef UNA_AT_MODE_SLAVE
 /*!******************************************************************
  * \fn UNA_AT_write_register_cb_t
@@ -59,6 +132,28 @@ typedef AT_status_t (*UNA_AT_write_register_cb_t)(uint8_t reg_addr, uint32_t reg
 typedef AT_status_t (*UNA_AT_read_register_cb_t)(uint8_t reg_addr, uint32_t* reg_value);
 #endif
 
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*!******************************************************************
+ * \fn UNA_AT_baud_rate_cb_t
+ * \brief Bus baud rate change callback.
+ *******************************************************************/
+typedef void (*UNA_AT_baud_rate_cb_t)(uint32_t baud_rate);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BLOCK_TRANSFER))
+/*!******************************************************************
+ * \fn UNA_AT_write_block_cb_t
+ * \brief Write block chunk command callback.
+ *******************************************************************/
+typedef AT_status_t (*UNA_AT_write_block_cb_t)(uint8_t block_addr, uint32_t offset, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn UNA_AT_read_block_cb_t
+ * \brief Read block chunk command callback.
+ *******************************************************************/
+typedef AT_status_t (*UNA_AT_read_block_cb_t)(uint8_t block_addr, uint32_t offset, uint8_t* data, uint32_t data_size_bytes);
+#endif
+
 /*!******************************************************************
  * \fn UNA_AT_configuration_t
  * \brief UNA AT configuration structure.
@@ -66,14 +161,28 @@ typedef AT_status_t (*UNA_AT_read_register_cb_t)(uint8_t reg_addr, uint32_t* reg
 typedef struct {
 #ifdef UNA_AT_MODE_MASTER
     uint32_t baud_rate;
+#ifdef UNA_AT_NOTIFICATIONS
+    UNA_AT_notification_cb_t notification_callback;
+#endif
 #endif
 #ifdef UNA_AT_MODE_SLAVE
     UNA_AT_process_cb_t process_callback;
     UNA_AT_write_register_cb_t write_register_callback;
     UNA_AT_read_register_cb_t read_register_callback;
+#ifdef UNA_AT_BLOCK_TRANSFER
+    UNA_AT_write_block_cb_t write_block_callback;
+    UNA_AT_read_block_cb_t read_block_callback;
+#endif
 #ifdef UNA_AT_CUSTOM_COMMANDS
     PARSER_context_t** parser_context_ptr;
 #endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    uint32_t default_baud_rate;
+    UNA_AT_baud_rate_cb_t baud_rate_callback;
+#endif
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_GATEWAY))
+    UNA_node_address_t node_addr;
+#endif
 #endif
 } UNA_AT_configuration_t;
 
@@ -108,6 +217,19 @@ UNA_AT_status_t UNA_AT_de_init(void);
 UNA_AT_status_t UNA_AT_send_command(UNA_command_parameters_t* command_parameters);
 #endif
 
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_REPLY_STREAMING))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_send_command_stream(UNA_command_parameters_t* command_parameters, uint32_t timeout_ms, UNA_AT_reply_line_cb_t line_callback, UNA_access_status_t* command_status)
+ * \brief Send a command over UNA AT interface and stream its reply lines until the OK or ERROR status.
+ * \param[in]   command_parameters: Pointer to the command parameters.
+ * \param[in]   timeout_ms: Maximum delay between two reply lines in ms.
+ * \param[in]   line_callback: Function called on each reply line (the line buffer is only valid during the call).
+ * \param[out]  command_status: Pointer to the command status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_send_command_stream(UNA_command_parameters_t* command_parameters, uint32_t timeout_ms, UNA_AT_reply_line_cb_t line_callback, UNA_access_status_t* command_status);
+#endif
+
 #ifdef UNA_AT_MODE_MASTER
 /*!******************************************************************
  * \fn UNA_AT_status_t UNA_AT_write_register(UNA_access_parameters_t* write_parameters, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status)
@@ -133,6 +255,228 @@ UNA_AT_status_t UNA_AT_write_register(UNA_access_parameters_t* write_parameters,
 UNA_AT_status_t UNA_AT_read_register(UNA_access_parameters_t* read_parameters, uint32_t* reg_value, UNA_access_status_t* read_status);
 #endif
 
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_WRITE_READ))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_write_read_register(UNA_access_parameters_t* write_parameters, uint32_t reg_value, uint32_t reg_mask, uint32_t* read_value, UNA_access_status_t* write_status)
+ * \brief Write node register and read back the applied value in a single access.
+ * \param[in]   write_parameters: Pointer to the write operation parameters (the reply type is ignored).
+ * \param[in]   reg_value: Register value to write.
+ * \param[in]   reg_mask: Writing operation mask.
+ * \param[out]  read_value: Pointer to the register value read back after writing.
+ * \param[out]  write_status: Pointer to the writing operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_write_read_register(UNA_access_parameters_t* write_parameters, uint32_t reg_value, uint32_t reg_mask, uint32_t* read_value, UNA_access_status_t* write_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_COMPARE_AND_SWAP))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_compare_and_swap_register(UNA_access_parameters_t* cas_parameters, uint32_t expected_value, uint32_t new_value, uint32_t reg_mask, uint32_t* old_value, uint8_t* swap_done, UNA_access_status_t* cas_status)
+ * \brief Atomically write node register if its current masked value is the expected one. The command is not retried: when the access fails, the register may have been written.
+ * \param[in]   cas_parameters: Pointer to the operation parameters (the reply type is ignored).
+ * \param[in]   expected_value: Expected current register value.
+ * \param[in]   new_value: Register value to write.
+ * \param[in]   reg_mask: Comparison and writing operation mask.
+ * \param[out]  old_value: Pointer to the register value observed before the operation.
+ * \param[out]  swap_done: Pointer to the result (1 if the register has been written, 0 otherwise).
+ * \param[out]  cas_status: Pointer to the operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_compare_and_swap_register(UNA_access_parameters_t* cas_parameters, uint32_t expected_value, uint32_t new_value, uint32_t reg_mask, uint32_t* old_value, uint8_t* swap_done, UNA_access_status_t* cas_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_CONDITIONAL_WAIT))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_wait_register(UNA_access_parameters_t* wait_parameters, uint32_t reg_mask, uint32_t expected_value, uint32_t wait_ms, uint32_t* reg_value, uint8_t* condition_met, UNA_access_status_t* wait_status)
+ * \brief Wait until the masked value of a node register is the expected one, without polling the register.
+ * \brief The node evaluates the condition and sends the register value once it holds or when the wait expires.
+ * \param[in]   wait_parameters: Pointer to the access parameters (reply timeout is the margin added to the wait duration).
+ * \param[in]   reg_mask: Mask of the register field to check.
+ * \param[in]   expected_value: Expected register value.
+ * \param[in]   wait_ms: Maximum wait duration in ms.
+ * \param[out]  reg_value: Pointer to the last read register value.
+ * \param[out]  condition_met: Pointer to the result (1 if the masked register value is the expected one, 0 otherwise).
+ * \param[out]  wait_status: Pointer to the wait operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_wait_register(UNA_access_parameters_t* wait_parameters, uint32_t reg_mask, uint32_t expected_value, uint32_t wait_ms, uint32_t* reg_value, uint8_t* condition_met, UNA_access_status_t* wait_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BATCH))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_execute_batch(UNA_AT_batch_operation_t* operation_list, uint8_t operation_count, uint32_t* batch_time_ms)
+ * \brief Execute a list of registers accesses on one or several nodes in a single pipelined sequence.
+ * \brief Each command is built while the previous node is processing its command, and operations without reply are sent back to back.
+ * \brief Failed operations are retried up to UNA_AT_NODE_ACCESS_RETRY_MAX times and counted by the baud rate fallback like single accesses, the access status of each operation must still be checked by the caller.
+ * \param[in]   operation_list: List of operations to execute, updated with the read values and the access status.
+ * \param[in]   operation_count: Number of operations in the list.
+ * \param[out]  batch_time_ms: Pointer to the total execution time of the batch in milliseconds.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_execute_batch(UNA_AT_batch_operation_t* operation_list, uint8_t operation_count, uint32_t* batch_time_ms);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_negotiate_baud_rate(UNA_node_t* node_list, uint8_t node_count, uint32_t baud_rate_max, uint32_t* baud_rate)
+ * \brief Switch the bus to the highest baud rate supported by all nodes.
+ * \param[in]   node_list: List of nodes connected to the bus (given by the scan function).
+ * \param[in]   node_count: Number of nodes in the list.
+ * \param[in]   baud_rate_max: Maximum baud rate supported by the master.
+ * \param[out]  baud_rate: Pointer to the baud rate used on the bus after the procedure.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_negotiate_baud_rate(UNA_node_t* node_list, uint8_t node_count, uint32_t baud_rate_max, uint32_t* baud_rate);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BROADCAST_NODE_ADDRESS))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_broadcast_write_register(uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask)
+ * \brief Write a register of all nodes with a single broadcast frame (no reply is expected).
+ * \param[in]   reg_addr: Address of the register to write.
+ * \param[in]   reg_value: Register value to write.
+ * \param[in]   reg_mask: Writing operation mask.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_broadcast_write_register(uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BROADCAST_NODE_ADDRESS))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_broadcast_verify_register(UNA_node_t* node_list, uint8_t node_count, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask, uint32_t timeout_ms, uint8_t* failed_count)
+ * \brief Check a previous broadcast write and rewrite the register of the nodes which did not apply it.
+ * \param[in]   node_list: List of nodes to check.
+ * \param[in]   node_count: Number of nodes in the list.
+ * \param[in]   reg_addr: Address of the broadcasted register.
+ * \param[in]   reg_value: Broadcasted register value.
+ * \param[in]   reg_mask: Broadcasted writing operation mask.
+ * \param[in]   timeout_ms: Node access timeout in ms.
+ * \param[out]  failed_count: Pointer to the number of nodes which could not be updated.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_broadcast_verify_register(UNA_node_t* node_list, uint8_t node_count, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask, uint32_t timeout_ms, uint8_t* failed_count);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_write_block(UNA_access_parameters_t* write_params, uint32_t offset, uint8_t* data, uint32_t data_size_bytes, uint8_t chunk_size_bytes, UNA_access_status_t* write_status)
+ * \brief Write node data block through UNA AT interface.
+ * \param[in]   write_parameters: Pointer to the write operation parameters (the register address field is used as block address).
+ * \param[in]   offset: Byte offset in the node block.
+ * \param[in]   data: Data to write.
+ * \param[in]   data_size_bytes: Number of bytes to write.
+ * \param[in]   chunk_size_bytes: Size of each transmitted chunk (up to UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES).
+ * \param[out]  write_status: Pointer to the writing operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_write_block(UNA_access_parameters_t* write_params, uint32_t offset, uint8_t* data, uint32_t data_size_bytes, uint8_t chunk_size_bytes, UNA_access_status_t* write_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_read_block(UNA_access_parameters_t* read_params, uint32_t offset, uint8_t* data, uint32_t data_size_bytes, uint8_t chunk_size_bytes, UNA_access_status_t* read_status)
+ * \brief Read node data block through UNA AT interface.
+ * \param[in]   read_parameters: Pointer to the read operation parameters (the register address field is used as block address).
+ * \param[in]   offset: Byte offset in the node block.
+ * \param[in]   data_size_bytes: Number of bytes to read.
+ * \param[in]   chunk_size_bytes: Size of each received chunk (up to UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES).
+ * \param[out]  data: Pointer to the read data.
+ * \param[out]  read_status: Pointer to the read operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_read_block(UNA_access_parameters_t* read_params, uint32_t offset, uint8_t* data, uint32_t data_size_bytes, uint8_t chunk_size_bytes, UNA_access_status_t* read_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_NOTIFICATIONS))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_poll_notifications(UNA_node_address_t node_addr, uint32_t timeout_ms, uint8_t* notification_count, UNA_access_status_t* poll_status)
+ * \brief Collect and acknowledge the pending notifications of a node, which are given to the notification callback (a notification can be given twice when the poll is retried).
+ * \param[in]   node_addr: Address of the node to poll.
+ * \param[in]   timeout_ms: Node access timeout in ms.
+ * \param[out]  notification_count: Pointer to the number of received notifications.
+ * \param[out]  poll_status: Pointer to the poll operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_poll_notifications(UNA_node_address_t node_addr, uint32_t timeout_ms, uint8_t* notification_count, UNA_access_status_t* poll_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_DIRTY_REGISTERS))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_read_dirty_registers(UNA_node_address_t node_addr, uint32_t timeout_ms, uint32_t* reg_mirror, uint16_t reg_mirror_size, uint16_t* update_count, UNA_access_status_t* read_status)
+ * \brief Read the registers modified since the last synchronization, update the local mirror and acknowledge the complete list to the node.
+ * \param[in]   node_addr: Address of the node to synchronize.
+ * \param[in]   timeout_ms: Node access timeout in ms.
+ * \param[in]   reg_mirror_size: Number of registers of the mirror.
+ * \param[out]  reg_mirror: Registers mirror of the node, indexed by register address.
+ * \param[out]  update_count: Pointer to the number of updated registers.
+ * \param[out]  read_status: Pointer to the read operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_read_dirty_registers(UNA_node_address_t node_addr, uint32_t timeout_ms, uint32_t* reg_mirror, uint16_t reg_mirror_size, uint16_t* update_count, UNA_access_status_t* read_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_SNAPSHOT))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_read_snapshot(UNA_access_parameters_t* read_parameters, uint8_t reg_count, uint32_t* reg_values, UNA_access_status_t* read_status)
+ * \brief Latch a registers range on a node and read the consistent values in a single access.
+ * \brief Following reads of the range are served from the latched values until the release or the next latch.
+ * \param[in]   read_parameters: Pointer to the access parameters (register address is the first register of the range).
+ * \param[in]   reg_count: Number of registers to latch.
+ * \param[out]  reg_values: Latched values of the range, indexed from the first register.
+ * \param[out]  read_status: Pointer to the read operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_read_snapshot(UNA_access_parameters_t* read_parameters, uint8_t reg_count, uint32_t* reg_values, UNA_access_status_t* read_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_SNAPSHOT))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_release_snapshot(UNA_node_address_t node_addr, uint32_t timeout_ms, UNA_access_status_t* release_status)
+ * \brief Release the latched registers of a node.
+ * \param[in]   node_addr: Address of the node.
+ * \param[in]   timeout_ms: Node access timeout in ms.
+ * \param[out]  release_status: Pointer to the release operation status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_release_snapshot(UNA_node_address_t node_addr, uint32_t timeout_ms, UNA_access_status_t* release_status);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_polling_start(UNA_AT_polling_entry_t* polling_table, uint8_t polling_table_size, UNA_AT_polling_cb_t polling_callback)
+ * \brief Start periodic registers polling.
+ * \param[in]   polling_table: Table of registers to poll (results are written in each entry).
+ * \param[in]   polling_table_size: Number of entries of the table.
+ * \param[in]   polling_callback: Function called after each access (optional).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_polling_start(UNA_AT_polling_entry_t* polling_table, uint8_t polling_table_size, UNA_AT_polling_cb_t polling_callback);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_polling_stop(void)
+ * \brief Stop periodic registers polling.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_polling_stop(void);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_polling_process(uint32_t* idle_time_ms)
+ * \brief Perform the most urgent pending polling access (earliest deadline first).
+ * \param[in]   none
+ * \param[out]  idle_time_ms: Pointer to the time before the next pending access.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_polling_process(uint32_t* idle_time_ms);
+#endif
+
 #ifdef UNA_AT_MODE_MASTER
 /*!******************************************************************
  * \fn UNA_AT_status_t UNA_AT_scan(UNA_node_t* node_list, uint8_t node_list_size, uint8_t* node_count)
@@ -156,10 +500,56 @@ UNA_AT_status_t UNA_AT_scan(UNA_node_t* node_list, uint8_t node_list_size, uint8
 UNA_AT_status_t UNA_AT_process(void);
 #endif
 
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_DIRTY_REGISTERS))
+/*!******************************************************************
+ * \fn void UNA_AT_set_dirty_register(uint8_t reg_addr)
+ * \brief Mark a register as modified since the last master synchronization (can be called from interrupt context).
+ * \param[in]   reg_addr: Address of the modified register.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_AT_set_dirty_register(uint8_t reg_addr);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*!******************************************************************
+ * \fn void UNA_AT_set_irq_read_register(uint8_t reg_addr, uint32_t reg_value)
+ * \brief Update the snapshot of a register answered directly from the reception interrupt.
+ * \param[in]   reg_addr: Address of the register.
+ * \param[in]   reg_value: Current register value.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_AT_set_irq_read_register(uint8_t reg_addr, uint32_t reg_value);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*!******************************************************************
+ * \fn void UNA_AT_irq_read_rx_callback(uint8_t data)
+ * \brief Byte reception callback, to be called from the bus reception interrupt before the byte is given to the AT driver.
+ * \param[in]   data: Received byte.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_AT_irq_read_rx_callback(uint8_t data);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_notify(uint8_t reg_addr, uint32_t reg_value)
+ * \brief Queue a register change notification, sent on the next master poll and dequeued once acknowledged. Can be called from a single interrupt or from the main loop, but not from both.
+ * \param[in]   reg_addr: Address of the modified register.
+ * \param[in]   reg_value: New register value.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_notify(uint8_t reg_addr, uint32_t reg_value);
+#endif
+
 #if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_CUSTOM_COMMANDS))
 /*!******************************************************************
  * \fn UNA_AT_status_t UNA_AT_register_command(const AT_command_t* command)
- * \brief Register additional custom AT command.
+ * \brief Register additional custom AT command (at most UNA_AT_CUSTOM_COMMANDS_NUMBER when the baud rate negotiation is enabled).
  * \param[in]   command: Pointer to the command to register.
  * \param[out]  none
  * \retval      Function execution status.
@@ -16,6 +16,18 @@
 
 #ifndef UNA_AT_DISABLE
 
+/*** UNA AT HW structures ***/
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*!******************************************************************
+ * \fn UNA_AT_HW_rx_dma_cb_t
+ * \brief DMA reception callback, to be called on idle line or carriage return detection.
+ * \param[in]   write_index: Current DMA write index in the circular reception buffer.
+ * \param[in]   overrun_flag: Set when the DMA may have written more than the buffer size since the previous call (for example on a second half or full transfer event).
+ *******************************************************************/
+typedef void (*UNA_AT_HW_rx_dma_cb_t)(uint32_t write_index, uint8_t overrun_flag);
+#endif
+
 /*** UNA AT HW functions ***/
 
 /*!******************************************************************
@@ -27,6 +39,73 @@
  *******************************************************************/
 UNA_AT_status_t UNA_AT_HW_delay_milliseconds(uint32_t delay_ms);
 
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_HW_get_tick_ms(uint32_t* tick_ms)
+ * \brief Read the monotonic system tick (the library falls back on its accumulated delays if not implemented).
+ * \param[in]   none
+ * \param[out]  tick_ms: Pointer to the current tick value in ms (free-running, wraps around at 2^32).
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_HW_get_tick_ms(uint32_t* tick_ms);
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_HW_rx_dma_start(uint8_t* rx_buffer, uint32_t rx_buffer_size_bytes, UNA_AT_HW_rx_dma_cb_t rx_dma_callback)
+ * \brief Start circular DMA reception on the bus terminal.
+ * \param[in]   rx_buffer: Circular reception buffer.
+ * \param[in]   rx_buffer_size_bytes: Size of the reception buffer.
+ * \param[in]   rx_dma_callback: Function to call on idle line or carriage return detection.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_HW_rx_dma_start(uint8_t* rx_buffer, uint32_t rx_buffer_size_bytes, UNA_AT_HW_rx_dma_cb_t rx_dma_callback);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_HW_rx_dma_stop(void)
+ * \brief Stop DMA reception on the bus terminal.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_HW_rx_dma_stop(void);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_GATEWAY))))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_HW_get_destination_address(UNA_node_address_t* destination_address)
+ * \brief Read the destination address of the last command received on the bus terminal.
+ * \param[in]   none
+ * \param[out]  destination_address: Pointer to the destination address of the command.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_HW_get_destination_address(UNA_node_address_t* destination_address);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_IRQ_READ)))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_HW_set_reply_mute(uint8_t mute_flag)
+ * \brief Enable or disable the transmission on the bus terminal (including the status sent by the AT driver).
+ * \param[in]   mute_flag: Discard all the bytes to transmit if non zero, transmit them otherwise.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_HW_set_reply_mute(uint8_t mute_flag);
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*!******************************************************************
+ * \fn UNA_AT_status_t UNA_AT_HW_send_irq_reply(uint8_t* reply, uint32_t reply_size_bytes)
+ * \brief Send a complete reply to the master node from the reception interrupt, without blocking.
+ * \param[in]   reply: Bytes to send.
+ * \param[in]   reply_size_bytes: Number of bytes to send.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AT_status_t UNA_AT_HW_send_irq_reply(uint8_t* reply, uint32_t reply_size_bytes);
+#endif
+
 #endif /* UNA_AT_DISABLE */
 
 #endif /* __UNA_AT_HW_H__ */
@@ -33,25 +33,108 @@
 #define UNA_AT_COMMAND_SEPARATOR        ","
 #endif
 #ifdef UNA_AT_MODE_SLAVE
-#define UNA_AT_COMMAND_SEPARATOR        STRING_CHAR_COMMA
+#define UNA_AT_PARAMETER_SEPARATOR      STRING_CHAR_COMMA
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_MODE_SLAVE))
+// Gateway: the master drives the downstream bus while the slave serves the upstream one.
+#define UNA_AT_MASTER_TERMINAL_INSTANCE UNA_AT_GATEWAY_TERMINAL_INSTANCE
+#else
+#define UNA_AT_MASTER_TERMINAL_INSTANCE UNA_AT_TERMINAL_INSTANCE
+#endif
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_GATEWAY))
+#define UNA_AT_GATEWAY_FORWARDING
+// Only the registers accesses are forwarded, other commands addressed to a downstream node are rejected.
+#define UNA_AT_reject_forwarded_command() { if (una_at_ctx.forward_flag != 0) return AT_ERROR_COMMAND_EXECUTION; }
+#else
+#define UNA_AT_reject_forwarded_command()
 #endif
 
 #ifdef UNA_AT_MODE_MASTER
-#define UNA_AT_REPLY_PARSING_DELAY_MS   20
+#define UNA_AT_REPLY_PARSING_DELAY_MS   5
+#define UNA_AT_REPLY_DRAIN_DELAY_MS     1
 #define UNA_AT_SEQUENCE_TIMEOUT_MS      120000
 
+#define UNA_AT_DEADLINE_REACHED(tick_ms, deadline_ms)   (((int32_t) ((tick_ms) - (deadline_ms))) > 0)
+
 #define UNA_AT_COMMAND_WRITE_REGISTER   "AT$W="
 #define UNA_AT_COMMAND_READ_REGISTER    "AT$R="
+#ifdef UNA_AT_WRITE_READ
+#define UNA_AT_COMMAND_WRITE_READ       "AT$WR="
+#endif
+#ifdef UNA_AT_COMPARE_AND_SWAP
+#define UNA_AT_COMMAND_COMPARE_AND_SWAP "AT$CAS="
+#endif
+#ifdef UNA_AT_BLOCK_TRANSFER
+#define UNA_AT_COMMAND_WRITE_BLOCK      "AT$BW="
+#define UNA_AT_COMMAND_READ_BLOCK       "AT$BR="
+#endif
+#ifdef UNA_AT_NOTIFICATIONS
+#define UNA_AT_COMMAND_NOTIFICATIONS    "AT$N?"
+#define UNA_AT_COMMAND_NOTIFICATION_ACK "AT$NA"
+#endif
+#ifdef UNA_AT_DIRTY_REGISTERS
+#define UNA_AT_COMMAND_DIRTY_REGISTERS  "AT$D?"
+#define UNA_AT_COMMAND_DIRTY_ACK        "AT$DA"
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+#define UNA_AT_COMMAND_BAUD_RATE        "AT$BAUD="
+#endif
+#ifdef UNA_AT_SNAPSHOT
+#define UNA_AT_COMMAND_LATCH            "AT$L="
+#define UNA_AT_COMMAND_RELEASE          "AT$LR"
+#endif
+#ifdef UNA_AT_CONDITIONAL_WAIT
+#define UNA_AT_COMMAND_CONDITIONAL_WAIT "AT$CW="
+#endif
 #define UNA_AT_COMMAND_END              "\r"
 
-#define UNA_AT_REPLY_BUFFER_SIZE_BYTES  128
 #define UNA_AT_REPLY_BUFFER_DEPTH       4
-#define UNA_AT_REPLY_OK                 "OK"
 #define UNA_AT_REPLY_ERROR              "ERROR"
+#endif
+#if ((defined UNA_AT_MODE_MASTER) || (defined UNA_AT_IRQ_READ))
+// Status line sent by the AT driver, also built by the interrupt reads.
+#define UNA_AT_REPLY_OK                 "OK"
 #define UNA_AT_REPLY_END                STRING_CHAR_CR
 #endif
 #ifdef UNA_AT_MODE_SLAVE
 #define UNA_AT_REPLY_DELAY_MS           5
+#define UNA_AT_REPLY_SEPARATOR          ","
+#ifdef UNA_AT_CONDITIONAL_WAIT
+#define UNA_AT_REPLY_ERROR              "ERROR"
+#endif
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+#define UNA_AT_COMMAND_HEADER           "AT"
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+#define UNA_AT_IRQ_READ_HEADER          "AT$R="
+#define UNA_AT_IRQ_READ_ADDRESS_DIGITS  2
+#define UNA_AT_IRQ_READ_LINE_SIZE_BYTES (sizeof(UNA_AT_IRQ_READ_HEADER) - 1 + UNA_AT_IRQ_READ_ADDRESS_DIGITS)
+#define UNA_AT_IRQ_READ_REPLY_SIZE_BYTES ((UNA_REGISTER_SIZE_BYTES << 1) + sizeof(UNA_AT_REPLY_OK) + 1)
+#define UNA_AT_IRQ_READ_HEXADECIMAL     "0123456789ABCDEF"
+#define UNA_AT_IRQ_READ_BITMAP_SIZE     ((UNA_AT_IRQ_READ_REGISTERS_NUMBER + 31) / 32)
+#endif
+
+#ifdef UNA_AT_BLOCK_TRANSFER
+#define UNA_AT_BLOCK_CRC_POLYNOMIAL     0x1021
+#define UNA_AT_BLOCK_CRC_INIT           0xFFFF
+#endif
+
+#ifdef UNA_AT_NOTIFICATIONS
+#define UNA_AT_NOTIFICATION_HEADER      "$N="
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+// One slot is kept empty to distinguish a full queue from an empty one.
+#define UNA_AT_NOTIFICATION_QUEUE_SIZE  (UNA_AT_NOTIFICATION_QUEUE_DEPTH + 1)
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+#define UNA_AT_BAUD_RATE_REGISTER_UNIT      100
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_DIRTY_REGISTERS))
+#define UNA_AT_DIRTY_BITMAP_SIZE        ((UNA_AT_DIRTY_REGISTERS_NUMBER + 31) / 32)
 #endif
 
 /*** UNA AT local structures ***/
@@ -62,16 +145,94 @@ typedef struct {
     volatile char_t buffer[UNA_AT_REPLY_BUFFER_SIZE_BYTES];
     volatile uint32_t size;
     volatile uint8_t line_end_flag;
+#ifdef UNA_AT_NOTIFICATIONS
+    volatile uint8_t notification_flag;
+#endif
     PARSER_context_t parser;
 } UNA_AT_reply_buffer_t;
 #endif
 
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+/*******************************************************************/
+typedef struct {
+    uint8_t reg_addr;
+    uint32_t reg_value;
+} UNA_AT_notification_t;
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+typedef void (*UNA_AT_line_cb_t)(PARSER_context_t* parser);
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+typedef struct {
+    uint8_t* data;
+    uint32_t offset;
+    uint32_t size;
+    uint8_t chunk_size;
+    uint32_t chunk_bitmap;
+} UNA_AT_block_context_t;
+#endif
+
+#if ((defined UNA_AT_GATEWAY_FORWARDING) && (UNA_AT_GATEWAY_CACHE_SIZE > 0))
+/*******************************************************************/
+typedef struct {
+    uint8_t valid_flag;
+    UNA_node_address_t node_addr;
+    uint8_t reg_addr;
+    uint32_t reg_value;
+    uint32_t update_tick_ms;
+} UNA_AT_gateway_cache_entry_t;
+#endif
+
 /*******************************************************************/
 typedef struct {
 #ifdef UNA_AT_MODE_MASTER
     UNA_AT_reply_buffer_t reply[UNA_AT_REPLY_BUFFER_DEPTH];
     volatile uint8_t reply_write_idx;
     volatile uint8_t reply_read_idx;
+    volatile uint8_t reply_overflow_flag;
+    uint8_t reply_drain_flag;
+#ifdef UNA_AT_REPLY_STREAMING
+    UNA_AT_reply_line_cb_t reply_line_callback;
+#endif
+#ifdef UNA_AT_BLOCK_TRANSFER
+    UNA_AT_block_context_t block;
+#endif
+#ifdef UNA_AT_NOTIFICATIONS
+    UNA_node_address_t node_addr;
+    UNA_AT_notification_cb_t notification_callback;
+    uint8_t received_notification_count;
+#endif
+#ifdef UNA_AT_DIRTY_REGISTERS
+    uint32_t* dirty_mirror;
+    uint16_t dirty_mirror_size;
+    uint16_t dirty_count;
+#endif
+#ifdef UNA_AT_SNAPSHOT
+    uint32_t* snapshot_values;
+    uint8_t snapshot_reg_addr;
+    uint8_t snapshot_size;
+    uint8_t snapshot_count;
+#endif
+#ifdef UNA_AT_POLLING
+    UNA_AT_polling_entry_t* polling_table;
+    uint8_t polling_table_size;
+    UNA_AT_polling_cb_t polling_callback;
+#endif
+#ifdef UNA_AT_RX_DMA
+    uint8_t rx_dma_buffer[UNA_AT_RX_DMA_BUFFER_SIZE_BYTES];
+    uint32_t rx_dma_read_idx;
+    volatile uint8_t rx_enable_flag;
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    uint32_t baud_rate_default;
+    uint32_t baud_rate;
+    uint8_t baud_rate_error_count;
+    uint8_t baud_rate_monitor_flag;
+#endif
 #endif
 #ifdef UNA_AT_MODE_SLAVE
     volatile uint8_t at_process_flag;
@@ -79,7 +240,63 @@ typedef struct {
     UNA_AT_process_cb_t process_callback;
     UNA_AT_write_register_cb_t write_register_callback;
     UNA_AT_read_register_cb_t read_register_callback;
+#ifdef UNA_AT_BLOCK_TRANSFER
+    UNA_AT_write_block_cb_t write_block_callback;
+    UNA_AT_read_block_cb_t read_block_callback;
+    uint8_t block_chunk[UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES];
+#endif
+#ifdef UNA_AT_NOTIFICATIONS
+    volatile UNA_AT_notification_t notification_queue[UNA_AT_NOTIFICATION_QUEUE_SIZE];
+    volatile uint8_t notification_write_idx;
+    volatile uint8_t notification_read_idx;
+    uint8_t notification_sent_count;
+#endif
+#ifdef UNA_AT_DIRTY_REGISTERS
+    volatile uint8_t dirty_flag[UNA_AT_DIRTY_REGISTERS_NUMBER];
+    uint32_t dirty_sent_bitmap[UNA_AT_DIRTY_BITMAP_SIZE];
+#endif
+#ifdef UNA_AT_SNAPSHOT
+    uint32_t latch_value[UNA_AT_SNAPSHOT_REGISTERS_NUMBER];
+    volatile uint8_t latch_reg_addr;
+    volatile uint8_t latch_reg_count;
+#endif
+#ifdef UNA_AT_CONDITIONAL_WAIT
+    uint8_t wait_flag;
+    uint8_t wait_reg_addr;
+    uint32_t wait_reg_mask;
+    uint32_t wait_expected_value;
+    uint32_t wait_duration_ms;
+    uint32_t wait_start_tick_ms;
+#endif
+#ifdef UNA_AT_IRQ_READ
+    volatile uint32_t irq_read_value[UNA_AT_IRQ_READ_REGISTERS_NUMBER];
+    volatile uint32_t irq_read_bitmap[UNA_AT_IRQ_READ_BITMAP_SIZE];
+    volatile uint8_t irq_read_done_flag;
+    volatile uint8_t at_busy_flag;
+    uint8_t irq_read_line[UNA_AT_IRQ_READ_LINE_SIZE_BYTES];
+    uint8_t irq_read_line_size;
+    uint8_t irq_read_reply[UNA_AT_IRQ_READ_REPLY_SIZE_BYTES];
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    UNA_AT_baud_rate_cb_t baud_rate_callback;
+    uint32_t at_baud_rate_default;
+    uint32_t at_baud_rate;
+    uint32_t at_baud_rate_pending;
+    uint32_t at_command_tick_ms;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    const AT_command_t* custom_command[UNA_AT_CUSTOM_COMMANDS_NUMBER];
+#endif
+#endif
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+    UNA_node_address_t gateway_node_addr;
+    UNA_node_address_t forward_node_addr;
+    uint8_t forward_flag;
+#endif
+#if ((defined UNA_AT_GATEWAY_FORWARDING) && (UNA_AT_GATEWAY_CACHE_SIZE > 0))
+    UNA_AT_gateway_cache_entry_t gateway_cache[UNA_AT_GATEWAY_CACHE_SIZE];
 #endif
+    uint32_t delay_tick_ms;
 } UNA_AT_context_t;
 
 /*** UNA_AT local functions declaration ***/
@@ -88,6 +305,38 @@ typedef struct {
 /*******************************************************************/
 static AT_status_t _UNA_AT_write_register_callback(void);
 static AT_status_t _UNA_AT_read_register_callback(void);
+#ifdef UNA_AT_WRITE_READ
+static AT_status_t _UNA_AT_write_read_register_callback(void);
+#endif
+#ifdef UNA_AT_COMPARE_AND_SWAP
+static AT_status_t _UNA_AT_compare_and_swap_register_callback(void);
+#endif
+#ifdef UNA_AT_BLOCK_TRANSFER
+static AT_status_t _UNA_AT_write_block_callback(void);
+static AT_status_t _UNA_AT_read_block_callback(void);
+#endif
+#ifdef UNA_AT_NOTIFICATIONS
+static AT_status_t _UNA_AT_read_notifications_callback(void);
+static AT_status_t _UNA_AT_acknowledge_notifications_callback(void);
+#endif
+#ifdef UNA_AT_DIRTY_REGISTERS
+static AT_status_t _UNA_AT_read_dirty_registers_callback(void);
+static AT_status_t _UNA_AT_acknowledge_dirty_registers_callback(void);
+#endif
+#ifdef UNA_AT_SNAPSHOT
+static AT_status_t _UNA_AT_latch_registers_callback(void);
+static AT_status_t _UNA_AT_release_registers_callback(void);
+#endif
+#ifdef UNA_AT_CONDITIONAL_WAIT
+static AT_status_t _UNA_AT_conditional_wait_callback(void);
+#endif
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+static AT_status_t _UNA_AT_gateway_write_register(void);
+static AT_status_t _UNA_AT_gateway_read_register(void);
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+static AT_status_t _UNA_AT_set_baud_rate_callback(void);
 #endif
 
 /*** AT local global variables ***/
@@ -105,7 +354,95 @@ static const AT_command_t UNA_AT_COMMANDS_LIST[] = {
         .parameters = "<addr>[hex]",
         .description = "Read node register",
         .callback = &_UNA_AT_read_register_callback
-    }
+    },
+#ifdef UNA_AT_WRITE_READ
+    {
+        .syntax = "$WR=",
+        .parameters = "<addr[hex],data[hex]>",
+        .description = "Write node register and read back applied value",
+        .callback = &_UNA_AT_write_read_register_callback
+    },
+#endif
+#ifdef UNA_AT_COMPARE_AND_SWAP
+    {
+        .syntax = "$CAS=",
+        .parameters = "<addr[hex],expected[hex],data[hex]>",
+        .description = "Write node register only if its current value is the expected one",
+        .callback = &_UNA_AT_compare_and_swap_register_callback
+    },
+#endif
+#ifdef UNA_AT_BLOCK_TRANSFER
+    {
+        .syntax = "$BW=",
+        .parameters = "<addr[hex],offset[hex],data[hex],crc[hex]>",
+        .description = "Write node block chunk",
+        .callback = &_UNA_AT_write_block_callback
+    },
+    {
+        .syntax = "$BR=",
+        .parameters = "<addr[hex],offset[hex],size[hex],chunk_size[hex]>",
+        .description = "Read node block chunks",
+        .callback = &_UNA_AT_read_block_callback
+    },
+#endif
+#ifdef UNA_AT_NOTIFICATIONS
+    {
+        .syntax = "$N?",
+        .parameters = NULL,
+        .description = "Read pending notifications",
+        .callback = &_UNA_AT_read_notifications_callback
+    },
+    {
+        .syntax = "$NA",
+        .parameters = NULL,
+        .description = "Acknowledge notifications sent by the last read",
+        .callback = &_UNA_AT_acknowledge_notifications_callback
+    },
+#endif
+#ifdef UNA_AT_DIRTY_REGISTERS
+    {
+        .syntax = "$D?",
+        .parameters = NULL,
+        .description = "Read registers modified since last synchronization",
+        .callback = &_UNA_AT_read_dirty_registers_callback
+    },
+    {
+        .syntax = "$DA",
+        .parameters = NULL,
+        .description = "Acknowledge registers sent by the last synchronization",
+        .callback = &_UNA_AT_acknowledge_dirty_registers_callback
+    },
+#endif
+#ifdef UNA_AT_SNAPSHOT
+    {
+        .syntax = "$L=",
+        .parameters = "<addr[hex],count[hex]>",
+        .description = "Latch and read a registers range",
+        .callback = &_UNA_AT_latch_registers_callback
+    },
+    {
+        .syntax = "$LR",
+        .parameters = NULL,
+        .description = "Release latched registers",
+        .callback = &_UNA_AT_release_registers_callback
+    },
+#endif
+#ifdef UNA_AT_CONDITIONAL_WAIT
+    {
+        .syntax = "$CW=",
+        .parameters = "<addr[hex],mask[hex],expected[hex],wait_ms[hex]>",
+        .description = "Send node register value once the masked value is the expected one or when the wait expires",
+        .callback = &_UNA_AT_conditional_wait_callback
+    },
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+    {
+        .syntax = "$BAUD=",
+        .parameters = "<baud_rate[hex]>",
+        .description = "Set bus baud rate (applied after the reply)",
+        .callback = &_UNA_AT_set_baud_rate_callback
+    },
+#endif
 };
 #endif
 static UNA_AT_context_t una_at_ctx;
@@ -117,76 +454,251 @@ static UNA_AT_context_t una_at_ctx;
 static void _UNA_AT_rx_irq_callback(uint8_t data) {
     // Read current index.
     uint32_t idx = una_at_ctx.reply[una_at_ctx.reply_write_idx].size;
+    uint8_t next_write_idx = (uint8_t) ((una_at_ctx.reply_write_idx + 1) % UNA_AT_REPLY_BUFFER_DEPTH);
+#ifdef UNA_AT_NOTIFICATIONS
+    uint8_t header_idx = 0;
+#endif
     // Check ending characters.
     if (data == UNA_AT_REPLY_END) {
+        // Report overwritten or lost lines.
+        if (next_write_idx == una_at_ctx.reply_read_idx) {
+            una_at_ctx.reply_overflow_flag = 1;
+#ifdef UNA_AT_REPLY_STREAMING
+            // Streamed lines are given in order to the user, so the new line is dropped rather than overwriting unread ones.
+            if (una_at_ctx.reply_line_callback != NULL) {
+                una_at_ctx.reply[una_at_ctx.reply_write_idx].size = 0;
+                return;
+            }
+#endif
+        }
         // Set flag on current buffer.
         una_at_ctx.reply[una_at_ctx.reply_write_idx].buffer[idx] = STRING_CHAR_NULL;
+#ifdef UNA_AT_NOTIFICATIONS
+        // Demultiplex unsolicited notifications from replies.
+        una_at_ctx.reply[una_at_ctx.reply_write_idx].notification_flag = 1;
+        for (header_idx = 0; header_idx < (sizeof(UNA_AT_NOTIFICATION_HEADER) - 1); header_idx++) {
+            if (una_at_ctx.reply[una_at_ctx.reply_write_idx].buffer[header_idx] != UNA_AT_NOTIFICATION_HEADER[header_idx]) {
+                una_at_ctx.reply[una_at_ctx.reply_write_idx].notification_flag = 0;
+                break;
+            }
+        }
+#endif
         una_at_ctx.reply[una_at_ctx.reply_write_idx].line_end_flag = 1;
         // Switch buffer.
-        una_at_ctx.reply_write_idx = (uint8_t) ((una_at_ctx.reply_write_idx + 1) % UNA_AT_REPLY_BUFFER_DEPTH);
+        una_at_ctx.reply_write_idx = next_write_idx;
     }
-    else {
-        // Store incoming byte.
+    else if (idx < (UNA_AT_REPLY_BUFFER_SIZE_BYTES - 1)) {
+        // Store incoming byte (the last byte is kept for the null terminator).
         una_at_ctx.reply[una_at_ctx.reply_write_idx].buffer[idx] = (char_t) data;
         // Manage index.
-        idx = (uint32_t) ((idx + 1) % UNA_AT_REPLY_BUFFER_SIZE_BYTES);
-        una_at_ctx.reply[una_at_ctx.reply_write_idx].size = idx;
+        una_at_ctx.reply[una_at_ctx.reply_write_idx].size = (idx + 1);
     }
 }
 #endif
 
-#ifdef UNA_AT_MODE_SLAVE
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
 /*******************************************************************/
-static void _UNA_AT_at_process_callback(void) {
-    // Set local flag.
-    una_at_ctx.at_process_flag = 1;
-    // Ask for processing.
-    if (una_at_ctx.process_callback != NULL) {
-        una_at_ctx.process_callback();
+static void _UNA_AT_rx_dma_callback(uint32_t write_index, uint8_t overrun_flag) {
+    // Local variables.
+    uint32_t idx = una_at_ctx.rx_dma_read_idx;
+    // Unread bytes have been overwritten by the DMA: drop the current line and resynchronize on the write index.
+    if (overrun_flag != 0) {
+        if (una_at_ctx.rx_enable_flag != 0) {
+            una_at_ctx.reply_overflow_flag = 1;
+        }
+        una_at_ctx.reply[una_at_ctx.reply_write_idx].size = 0;
+        idx = write_index;
+    }
+    // Split the bytes received since last call, only while the receiver is enabled.
+    while (idx != write_index) {
+        if (una_at_ctx.rx_enable_flag != 0) {
+            _UNA_AT_rx_irq_callback(una_at_ctx.rx_dma_buffer[idx]);
+        }
+        idx++;
+        if (idx >= UNA_AT_RX_DMA_BUFFER_SIZE_BYTES) {
+            idx = 0;
+        }
     }
+    una_at_ctx.rx_dma_read_idx = idx;
 }
 #endif
 
 /*******************************************************************/
-#ifdef UNA_AT_MODE_MASTER
-static UNA_AT_status_t _UNA_AT_tx_buffer_add_register(uint32_t reg_value) {
-#endif
-#ifdef UNA_AT_MODE_SLAVE
-static void _UNA_AT_tx_buffer_add_register(uint32_t reg_value) {
-#endif
+static UNA_AT_status_t _UNA_AT_delay_milliseconds(uint32_t delay_ms) {
     // Local variables.
-#ifdef UNA_AT_MODE_MASTER
     UNA_AT_status_t status = UNA_AT_SUCCESS;
-    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Perform delay.
+    status = UNA_AT_HW_delay_milliseconds(delay_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Accumulate delays to provide a time base when the tick is not implemented.
+    una_at_ctx.delay_tick_ms += delay_ms;
+errors:
+    return status;
+}
+
+#if ((defined UNA_AT_MODE_MASTER) || (defined UNA_AT_CONDITIONAL_WAIT) || (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_get_tick_ms(uint32_t* tick_ms) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    // Read system tick.
+    status = UNA_AT_HW_get_tick_ms(tick_ms);
+    // Fall back on the accumulated delays if the tick is not implemented.
+    if (status == UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED) {
+        (*tick_ms) = una_at_ctx.delay_tick_ms;
+        status = UNA_AT_SUCCESS;
+    }
+    return status;
+}
 #endif
+
+/*******************************************************************/
+static uint8_t _UNA_AT_register_to_byte_array(uint32_t reg_value, uint8_t* data) {
+    // Local variables.
+    uint8_t data_size_bytes = 0;
     uint8_t byte = 0;
     uint8_t idx = 0;
-    uint8_t first_non_zero_found = 0;
     // Convert 32-bits value to byte array.
     for (idx = 0; idx < UNA_REGISTER_SIZE_BYTES; idx++) {
         // Compute byte.
         byte = (uint8_t) ((reg_value >> ((UNA_REGISTER_SIZE_BYTES - 1 - idx) << 3)) & 0xFF);
-        // Update flag.
-        if (byte != 0) {
-            first_non_zero_found = 1;
-        }
-        // Check flag and index.
-        if ((first_non_zero_found != 0) || (idx == (UNA_REGISTER_SIZE_BYTES - 1))) {
-            // Convert byte.
+        // Skip leading zero bytes but always keep the last one.
+        if ((data_size_bytes == 0) && (byte == 0) && (idx < (UNA_REGISTER_SIZE_BYTES - 1))) continue;
+        data[data_size_bytes++] = byte;
+    }
+    return data_size_bytes;
+}
+
 #ifdef UNA_AT_MODE_MASTER
-            terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_TERMINAL_INSTANCE, (int32_t) byte, STRING_FORMAT_HEXADECIMAL, 0);
-            TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_tx_buffer_add_register(uint8_t terminal_instance, uint32_t reg_value) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    uint8_t data[UNA_REGISTER_SIZE_BYTES];
+    uint8_t data_size_bytes = _UNA_AT_register_to_byte_array(reg_value, data);
+    // Add bytes.
+    terminal_status = TERMINAL_tx_buffer_add_byte_array(terminal_instance, data, data_size_bytes, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
 #endif
-#ifdef UNA_AT_MODE_SLAVE
-            AT_reply_add_integer((int32_t) byte, STRING_FORMAT_HEXADECIMAL, 0);
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+static void _UNA_AT_irq_read_register(void) {
+    // Local variables.
+    uint8_t* line = una_at_ctx.irq_read_line;
+    uint32_t idx = 0;
+    uint32_t reg_addr = 0;
+    uint8_t character = 0;
+    uint8_t data[UNA_REGISTER_SIZE_BYTES];
+    uint8_t data_size_bytes = 0;
+    uint32_t reply_size_bytes = 0;
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_GATEWAY_FORWARDING))
+    UNA_node_address_t destination_address = 0;
 #endif
+    // Any other syntax is left to the AT parser.
+    if ((una_at_ctx.irq_read_line_size < sizeof(UNA_AT_IRQ_READ_HEADER)) || (una_at_ctx.irq_read_line_size > UNA_AT_IRQ_READ_LINE_SIZE_BYTES)) goto errors;
+    // Check command header.
+    for (idx = 0; idx < (sizeof(UNA_AT_IRQ_READ_HEADER) - 1); idx++) {
+        if (line[idx] != (uint8_t) UNA_AT_IRQ_READ_HEADER[idx]) goto errors;
+    }
+    // Parse hexadecimal address.
+    for (; idx < una_at_ctx.irq_read_line_size; idx++) {
+        character = line[idx];
+        if ((character >= '0') && (character <= '9')) {
+            reg_addr = (reg_addr << 4) + (uint32_t) (character - '0');
+        }
+        else if ((character >= 'A') && (character <= 'F')) {
+            reg_addr = (reg_addr << 4) + (uint32_t) (character - 'A' + 10);
+        }
+        else if ((character >= 'a') && (character <= 'f')) {
+            reg_addr = (reg_addr << 4) + (uint32_t) (character - 'a' + 10);
+        }
+        else {
+            goto errors;
         }
     }
-#ifdef UNA_AT_MODE_MASTER
+    // Check if the register snapshot is available.
+    if (reg_addr >= UNA_AT_IRQ_READ_REGISTERS_NUMBER) goto errors;
+    if ((una_at_ctx.irq_read_bitmap[reg_addr / 32] & (((uint32_t) 0b1) << (reg_addr % 32))) == 0) goto errors;
+#ifdef UNA_AT_SNAPSHOT
+    // Latched registers are served by the deferred command processing.
+    if ((reg_addr - una_at_ctx.latch_reg_addr) < una_at_ctx.latch_reg_count) goto errors;
+#endif
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_GATEWAY_FORWARDING))
+    if (UNA_AT_HW_get_destination_address(&destination_address) != UNA_AT_SUCCESS) goto errors;
+#endif
+#ifdef UNA_AT_BROADCAST_NODE_ADDRESS
+    // Broadcast commands are never answered.
+    if (destination_address == UNA_AT_BROADCAST_NODE_ADDRESS) goto errors;
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+    // Commands addressed to the downstream nodes are forwarded by the deferred command processing.
+    if (destination_address != una_at_ctx.gateway_node_addr) goto errors;
+#endif
+    // Build the complete reply in the dedicated buffer, the terminal buffer may be in use by the main context.
+    data_size_bytes = _UNA_AT_register_to_byte_array(una_at_ctx.irq_read_value[reg_addr], data);
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        una_at_ctx.irq_read_reply[reply_size_bytes++] = (uint8_t) UNA_AT_IRQ_READ_HEXADECIMAL[(data[idx] >> 4) & 0x0F];
+        una_at_ctx.irq_read_reply[reply_size_bytes++] = (uint8_t) UNA_AT_IRQ_READ_HEXADECIMAL[data[idx] & 0x0F];
+    }
+    una_at_ctx.irq_read_reply[reply_size_bytes++] = (uint8_t) UNA_AT_REPLY_END;
+    for (idx = 0; idx < (sizeof(UNA_AT_REPLY_OK) - 1); idx++) {
+        una_at_ctx.irq_read_reply[reply_size_bytes++] = (uint8_t) UNA_AT_REPLY_OK[idx];
+    }
+    una_at_ctx.irq_read_reply[reply_size_bytes++] = (uint8_t) UNA_AT_REPLY_END;
+    // Send reply.
+    if (UNA_AT_HW_send_irq_reply(una_at_ctx.irq_read_reply, reply_size_bytes) != UNA_AT_SUCCESS) goto errors;
+    // Reply must not be sent again by the deferred command processing.
+    una_at_ctx.irq_read_done_flag = 1;
 errors:
-    return status;
+    return;
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static void _UNA_AT_at_process_callback(void) {
+    // Set local flag.
+    una_at_ctx.at_process_flag = 1;
+    // Ask for processing.
+    if (una_at_ctx.process_callback != NULL) {
+        una_at_ctx.process_callback();
+    }
+}
 #endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static void _UNA_AT_reply_add_register(uint32_t reg_value) {
+    // Local variables.
+    uint8_t data[UNA_REGISTER_SIZE_BYTES];
+    uint8_t data_size_bytes = _UNA_AT_register_to_byte_array(reg_value, data);
+    // Add bytes.
+    AT_reply_add_byte_array(data, data_size_bytes, 0);
+}
+#endif
+
+#ifdef UNA_AT_BLOCK_TRANSFER
+/*******************************************************************/
+static uint16_t _UNA_AT_compute_crc(uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    uint16_t crc = UNA_AT_BLOCK_CRC_INIT;
+    uint32_t idx = 0;
+    uint8_t bit_idx = 0;
+    // CRC16-CCITT loop.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        crc ^= (uint16_t) (data[idx] << 8);
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x8000) != 0) ? (uint16_t) ((crc << 1) ^ UNA_AT_BLOCK_CRC_POLYNOMIAL) : (uint16_t) (crc << 1);
+        }
+    }
+    return crc;
 }
+#endif
 
 #ifdef UNA_AT_MODE_MASTER
 /*******************************************************************/
@@ -198,8 +710,11 @@ static void _UNA_AT_flush_reply(uint8_t reply_index) {
         una_at_ctx.reply[reply_index].buffer[idx] = STRING_CHAR_NULL;
     }
     una_at_ctx.reply[reply_index].size = 0;
-    // Reset flag.
+    // Reset flags.
     una_at_ctx.reply[reply_index].line_end_flag = 0;
+#ifdef UNA_AT_NOTIFICATIONS
+    una_at_ctx.reply[reply_index].notification_flag = 0;
+#endif
     // Reset parser.
     una_at_ctx.reply[reply_index].parser.buffer = (char_t*) una_at_ctx.reply[reply_index].buffer;
     una_at_ctx.reply[reply_index].parser.buffer_size = 0;
@@ -220,64 +735,193 @@ static void _UNA_AT_flush_replies(void) {
     // Reset index and count.
     una_at_ctx.reply_write_idx = 0;
     una_at_ctx.reply_read_idx = 0;
+    una_at_ctx.reply_overflow_flag = 0;
 }
 #endif
 
-#ifdef UNA_AT_MODE_MASTER
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_NOTIFICATIONS))
 /*******************************************************************/
-static UNA_AT_status_t _UNA_AT_wait_reply(UNA_reply_parameters_t* reply_params, uint32_t* reg_value, UNA_access_status_t* reply_status) {
+static void _UNA_AT_decode_notification(PARSER_context_t* parser) {
     // Local variables.
-    UNA_AT_status_t status = UNA_AT_SUCCESS;
-    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
     PARSER_status_t parser_status = PARSER_SUCCESS;
-    uint32_t reply_time_ms = 0;
-    uint32_t sequence_time_ms = 0;
-    uint8_t reply_count = 0;
-    // Check parameters.
-    if ((reg_value == NULL) || (reply_status == NULL)) {
-        status = UNA_AT_ERROR_NULL_PARAMETER;
-        goto errors;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    // Skip header.
+    parser_status = PARSER_compare(parser, PARSER_MODE_HEADER, UNA_AT_NOTIFICATION_HEADER);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    // Parse register address and value.
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_COMMA, &reg_addr);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_NULL, &reg_value);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    // Deliver notification.
+    una_at_ctx.received_notification_count++;
+    if (una_at_ctx.notification_callback != NULL) {
+        una_at_ctx.notification_callback(una_at_ctx.node_addr, (uint8_t) reg_addr, reg_value);
     }
-    if ((reply_params->type) >= UNA_REPLY_TYPE_LAST) {
-        status = UNA_AT_ERROR_REPLY_TYPE;
-        goto errors;
+errors:
+    return;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_DIRTY_REGISTERS))
+/*******************************************************************/
+static void _UNA_AT_read_dirty_registers_line_callback(PARSER_context_t* parser) {
+    // Local variables.
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    // Parse register address and value.
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_COMMA, &reg_addr);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_NULL, &reg_value);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    // Update mirror.
+    if (reg_addr < una_at_ctx.dirty_mirror_size) {
+        una_at_ctx.dirty_mirror[reg_addr] = reg_value;
+        una_at_ctx.dirty_count++;
     }
-    // Reset status.
-    (reply_status->flags) = 0;
-    // Directly exit function with success status for none reply type.
-    if ((reply_params->type) == UNA_REPLY_TYPE_NONE) goto errors;
-    // Enable receiver.
-    terminal_status = TERMINAL_enable_rx(UNA_AT_TERMINAL_INSTANCE);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    // Main reception loop.
-    while (1) {
-        // Delay.
-        status = UNA_AT_HW_delay_milliseconds(UNA_AT_REPLY_PARSING_DELAY_MS);
-        if (status != UNA_AT_SUCCESS) goto errors;
-        // Update timers.
-        reply_time_ms += UNA_AT_REPLY_PARSING_DELAY_MS;
-        sequence_time_ms += UNA_AT_REPLY_PARSING_DELAY_MS;
-        // Check write index.
-        if (una_at_ctx.reply_write_idx != una_at_ctx.reply_read_idx) {
-            // Check line end flag.
-            if (una_at_ctx.reply[una_at_ctx.reply_read_idx].line_end_flag != 0) {
-                // Increment parsing count.
-                reply_count++;
-                // Reset time and flag.
-                reply_time_ms = 0;
-                una_at_ctx.reply[una_at_ctx.reply_read_idx].line_end_flag = 0;
-                // Update buffer length.
-                una_at_ctx.reply[una_at_ctx.reply_read_idx].parser.buffer_size = una_at_ctx.reply[una_at_ctx.reply_read_idx].size;
-                // Parse reply.
-                switch (reply_params->type) {
-                case UNA_REPLY_TYPE_OK:
-                    // Compare to reference string.
-                    parser_status = PARSER_compare(&una_at_ctx.reply[una_at_ctx.reply_read_idx].parser, PARSER_MODE_STRICT, UNA_AT_REPLY_OK);
-                    break;
-                case UNA_REPLY_TYPE_VALUE:
-                    // Parse register.
-                    parser_status = SWREG_parse_register(&una_at_ctx.reply[una_at_ctx.reply_read_idx].parser, STRING_CHAR_NULL, reg_value);
-                    break;
+errors:
+    return;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_SNAPSHOT))
+/*******************************************************************/
+static void _UNA_AT_read_snapshot_line_callback(PARSER_context_t* parser) {
+    // Local variables.
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    // Parse register address and value.
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_COMMA, &reg_addr);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_NULL, &reg_value);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    // The first register of the range starts a new access attempt.
+    if (reg_addr == una_at_ctx.snapshot_reg_addr) {
+        una_at_ctx.snapshot_count = 0;
+    }
+    // Registers are sent in order, any gap invalidates the end of the range.
+    if ((una_at_ctx.snapshot_count < una_at_ctx.snapshot_size) && ((reg_addr - una_at_ctx.snapshot_reg_addr) == una_at_ctx.snapshot_count)) {
+        una_at_ctx.snapshot_values[una_at_ctx.snapshot_count] = reg_value;
+        una_at_ctx.snapshot_count++;
+    }
+errors:
+    return;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_REPLY_STREAMING))
+/*******************************************************************/
+static void _UNA_AT_stream_line_callback(PARSER_context_t* parser) {
+    // Give the reception buffer directly to the user.
+    if (una_at_ctx.reply_line_callback != NULL) {
+        una_at_ctx.reply_line_callback((parser->buffer), (parser->buffer_size));
+    }
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_enable_rx(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+#ifdef UNA_AT_RX_DMA
+    // The DMA is always running, bytes are only split into lines while the receiver is enabled.
+    una_at_ctx.rx_enable_flag = 1;
+#endif
+    terminal_status = TERMINAL_enable_rx(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_disable_rx(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+#ifdef UNA_AT_RX_DMA
+    una_at_ctx.rx_enable_flag = 0;
+#endif
+    terminal_status = TERMINAL_disable_rx(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_wait_reply(UNA_reply_parameters_t* reply_params, UNA_AT_line_cb_t line_callback, uint32_t* reg_value, UNA_access_status_t* reply_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t tick_ms = 0;
+    uint32_t reply_deadline_ms = 0;
+    uint32_t sequence_deadline_ms = 0;
+    uint32_t delay_ms = 0;
+    uint32_t delay_step_ms = UNA_AT_REPLY_PARSING_DELAY_MS;
+    uint8_t reply_count = 0;
+    // Check parameters.
+    if ((reg_value == NULL) || (reply_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((reply_params->type) >= UNA_REPLY_TYPE_LAST) {
+        status = UNA_AT_ERROR_REPLY_TYPE;
+        goto errors;
+    }
+    // Reset status.
+    (reply_status->flags) = 0;
+    // Directly exit function with success status for none reply type.
+    if ((reply_params->type) == UNA_REPLY_TYPE_NONE) goto errors;
+    // Enable receiver.
+    status = _UNA_AT_enable_rx();
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Compute absolute deadlines.
+    status = _UNA_AT_get_tick_ms(&tick_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    reply_deadline_ms = (tick_ms + (reply_params->timeout_ms));
+    sequence_deadline_ms = (tick_ms + UNA_AT_SEQUENCE_TIMEOUT_MS);
+    // Main reception loop.
+    while (1) {
+        // Read current time.
+        status = _UNA_AT_get_tick_ms(&tick_ms);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Check write index.
+        if (una_at_ctx.reply_write_idx != una_at_ctx.reply_read_idx) {
+#ifdef UNA_AT_NOTIFICATIONS
+            // Unsolicited notification lines are not part of the reply.
+            if ((una_at_ctx.reply[una_at_ctx.reply_read_idx].line_end_flag != 0) && (una_at_ctx.reply[una_at_ctx.reply_read_idx].notification_flag != 0)) {
+                una_at_ctx.reply[una_at_ctx.reply_read_idx].line_end_flag = 0;
+                una_at_ctx.reply[una_at_ctx.reply_read_idx].parser.buffer_size = una_at_ctx.reply[una_at_ctx.reply_read_idx].size;
+                _UNA_AT_decode_notification(&una_at_ctx.reply[una_at_ctx.reply_read_idx].parser);
+            }
+#endif
+            // Check line end flag.
+            if (una_at_ctx.reply[una_at_ctx.reply_read_idx].line_end_flag != 0) {
+                // Increment parsing count.
+                reply_count++;
+                // Re-arm reply deadline and reset flag.
+                reply_deadline_ms = (tick_ms + (reply_params->timeout_ms));
+                una_at_ctx.reply[una_at_ctx.reply_read_idx].line_end_flag = 0;
+                // Update buffer length.
+                una_at_ctx.reply[una_at_ctx.reply_read_idx].parser.buffer_size = una_at_ctx.reply[una_at_ctx.reply_read_idx].size;
+                // Parse reply.
+                switch (reply_params->type) {
+                case UNA_REPLY_TYPE_OK:
+                    // Compare to reference string.
+                    parser_status = PARSER_compare(&una_at_ctx.reply[una_at_ctx.reply_read_idx].parser, PARSER_MODE_STRICT, UNA_AT_REPLY_OK);
+                    break;
+                case UNA_REPLY_TYPE_VALUE:
+                    // Parse register.
+                    parser_status = SWREG_parse_register(&una_at_ctx.reply[una_at_ctx.reply_read_idx].parser, STRING_CHAR_NULL, reg_value);
+                    break;
                 default:
                     status = UNA_AT_ERROR_REPLY_TYPE;
                     break;
@@ -295,13 +939,19 @@ static UNA_AT_status_t _UNA_AT_wait_reply(UNA_reply_parameters_t* reply_params,
                     (reply_status->error_received) = 1;
                     break;
                 }
+                // Forward intermediate lines of multi-lines replies.
+                if (((reply_params->type) == UNA_REPLY_TYPE_OK) && (line_callback != NULL)) {
+                    una_at_ctx.reply[una_at_ctx.reply_read_idx].parser.separator_index = 0;
+                    una_at_ctx.reply[una_at_ctx.reply_read_idx].parser.start_index = 0;
+                    line_callback(&una_at_ctx.reply[una_at_ctx.reply_read_idx].parser);
+                }
             }
             // Update read index.
             _UNA_AT_flush_reply(una_at_ctx.reply_read_idx);
             una_at_ctx.reply_read_idx = (uint8_t) ((una_at_ctx.reply_read_idx + 1) % UNA_AT_REPLY_BUFFER_DEPTH);
         }
         // Exit if timeout.
-        if (reply_time_ms > (reply_params->timeout_ms)) {
+        if (UNA_AT_DEADLINE_REACHED(tick_ms, reply_deadline_ms)) {
             // Set status to timeout if none reply has been received, otherwise the parser error code is returned.
             if (reply_count == 0) {
                 (reply_status->reply_timeout) = 1;
@@ -311,14 +961,76 @@ static UNA_AT_status_t _UNA_AT_wait_reply(UNA_reply_parameters_t* reply_params,
             }
             break;
         }
-        if (sequence_time_ms > UNA_AT_SEQUENCE_TIMEOUT_MS) {
+        if (UNA_AT_DEADLINE_REACHED(tick_ms, sequence_deadline_ms)) {
             // Set status to timeout in any case.
             (reply_status->sequence_timeout) = 1;
             break;
         }
+        // Sleep only if there is no pending line, and never beyond the earliest deadline.
+        if (una_at_ctx.reply_write_idx == una_at_ctx.reply_read_idx) {
+            // Compute remaining time before the earliest deadline.
+            delay_ms = (reply_deadline_ms - tick_ms);
+            if ((int32_t) (sequence_deadline_ms - reply_deadline_ms) < 0) {
+                delay_ms = (sequence_deadline_ms - tick_ms);
+            }
+            // Multi-lines replies are drained with a shorter step since they can be longer than the reply buffers.
+            if ((line_callback != NULL) || (una_at_ctx.reply_drain_flag != 0)) {
+                delay_step_ms = UNA_AT_REPLY_DRAIN_DELAY_MS;
+            }
+            // Wake up just after the deadline to trigger the timeout check.
+            delay_ms = (delay_ms < delay_step_ms) ? (delay_ms + 1) : delay_step_ms;
+            status = _UNA_AT_delay_milliseconds(delay_ms);
+            if (status != UNA_AT_SUCCESS) goto errors;
+        }
     }
+    // Lines lost during the access invalidate multi-lines replies (single line replies are checked by the parser).
+    if ((una_at_ctx.reply_overflow_flag != 0) && ((line_callback != NULL) || (una_at_ctx.reply_drain_flag != 0))) {
+        (reply_status->parser_error) = 1;
+    }
+errors:
+    _UNA_AT_disable_rx();
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_open_bus(uint32_t baud_rate) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+#ifdef UNA_AT_RX_DMA
+    // Reception is handled by the DMA, the terminal is only used for transmission.
+    terminal_status = TERMINAL_open(UNA_AT_MASTER_TERMINAL_INSTANCE, baud_rate, NULL);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    una_at_ctx.rx_dma_read_idx = 0;
+    una_at_ctx.rx_enable_flag = 0;
+    status = UNA_AT_HW_rx_dma_start(una_at_ctx.rx_dma_buffer, UNA_AT_RX_DMA_BUFFER_SIZE_BYTES, &_UNA_AT_rx_dma_callback);
+    if (status != UNA_AT_SUCCESS) goto errors;
+#else
+    terminal_status = TERMINAL_open(UNA_AT_MASTER_TERMINAL_INSTANCE, baud_rate, &_UNA_AT_rx_irq_callback);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+#endif
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_close_bus(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+#ifdef UNA_AT_RX_DMA
+    // Stop reception.
+    status = UNA_AT_HW_rx_dma_stop();
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+    // Release bus terminal.
+    terminal_status = TERMINAL_close(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
 errors:
-    TERMINAL_disable_rx(UNA_AT_TERMINAL_INSTANCE);
     return status;
 }
 #endif
@@ -331,295 +1043,2166 @@ static UNA_AT_status_t _UNA_AT_send(UNA_node_address_t node_address) {
     TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
     // Reset replies.
     _UNA_AT_flush_replies();
+#ifdef UNA_AT_NOTIFICATIONS
+    // Save destination for notifications source.
+    una_at_ctx.node_addr = node_address;
+#endif
     // Send command.
-    terminal_status = TERMINAL_set_destination_address(UNA_AT_TERMINAL_INSTANCE, node_address);
+    terminal_status = TERMINAL_set_destination_address(UNA_AT_MASTER_TERMINAL_INSTANCE, node_address);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_send_tx_buffer(UNA_AT_TERMINAL_INSTANCE);
+    terminal_status = TERMINAL_send_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
 errors:
     return status;
 }
 #endif
 
-#ifdef UNA_AT_MODE_SLAVE
+#ifdef UNA_AT_MODE_MASTER
 /*******************************************************************/
-static AT_status_t _UNA_AT_write_register_callback(void) {
+static UNA_AT_status_t _UNA_AT_build_write_command(char_t* command_header, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
     // Local variables.
-    AT_status_t status = AT_SUCCESS;
-    PARSER_status_t parser_status = PARSER_SUCCESS;
-    uint32_t reg_addr = 0;
-    uint32_t reg_value = 0;
-    uint32_t reg_mask = 0;
-    // Delay to ensure that the master node has switched to RX.
-    UNA_AT_HW_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
-    // Read address parameter.
-    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_COMMAND_SEPARATOR, &reg_addr);
-    PARSER_exit_error(AT_ERROR_BASE_PARSER);
-    // First try with 3 parameters.
-    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_COMMAND_SEPARATOR, &reg_value);
-    if (parser_status == PARSER_SUCCESS) {
-        // Try parsing register mask parameter.
-        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_mask);
-        PARSER_exit_error(AT_ERROR_BASE_PARSER);
-    }
-    else {
-        // Try with only 2 parameters.
-        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_value);
-        PARSER_exit_error(AT_ERROR_BASE_PARSER);
-        // Perform full write operation since mask is not given.
-        reg_mask = UNA_REGISTER_MASK_ALL;
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Build write command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, command_header);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) reg_addr, STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, reg_value);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Add mask if needed.
+    if (reg_mask != UNA_REGISTER_MASK_ALL) {
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, reg_mask);
+        if (status != UNA_AT_SUCCESS) goto errors;
     }
-    // Write register.
-    if (una_at_ctx.write_register_callback != NULL) {
-        // Execute write callback.
-        status = una_at_ctx.write_register_callback((uint8_t) reg_addr, reg_value, reg_mask);
-        if (status != AT_SUCCESS) goto errors;
+    // Add ending marker.
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_build_read_command(uint8_t reg_addr) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Build read command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_READ_REGISTER);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (uint32_t) reg_addr, STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Add ending marker.
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BATCH))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_build_batch_command(UNA_AT_batch_operation_t* operation) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    // Build command according to access type.
+    if ((operation->type) == UNA_ACCESS_TYPE_WRITE) {
+        status = _UNA_AT_build_write_command(UNA_AT_COMMAND_WRITE_REGISTER, (operation->access_params.reg_addr), (operation->reg_value), (operation->reg_mask));
     }
     else {
-        status = AT_ERROR_COMMAND_EXECUTION;
-        goto errors;
+        status = _UNA_AT_build_read_command(operation->access_params.reg_addr);
     }
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_switch_baud_rate(uint32_t baud_rate) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Build baud rate command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_BAUD_RATE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, baud_rate);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Send command to all nodes with the current baud rate.
+    status = _UNA_AT_send(UNA_AT_BROADCAST_NODE_ADDRESS);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Let the nodes apply the new baud rate.
+    status = _UNA_AT_delay_milliseconds(UNA_AT_BAUD_RATE_SWITCH_DELAY_MS);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Reconfigure bus terminal.
+    status = _UNA_AT_close_bus();
+    if (status != UNA_AT_SUCCESS) goto errors;
+    status = _UNA_AT_open_bus(baud_rate);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Update context.
+    una_at_ctx.baud_rate = baud_rate;
+    una_at_ctx.baud_rate_error_count = 0;
 errors:
     return status;
 }
 #endif
 
-#ifdef UNA_AT_MODE_SLAVE
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
 /*******************************************************************/
-static AT_status_t _UNA_AT_read_register_callback(void) {
+static UNA_AT_status_t _UNA_AT_check_baud_rate(UNA_access_status_t* access_status) {
     // Local variables.
-    AT_status_t status = AT_SUCCESS;
-    PARSER_status_t parser_status = PARSER_SUCCESS;
-    uint32_t reg_addr = 0;
-    uint32_t reg_value = 0;
-    // Delay to ensure that the master node has switched to RX.
-    UNA_AT_HW_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
-    // Read address parameter.
-    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_addr);
-    PARSER_exit_error(AT_ERROR_BASE_PARSER);
-    // Read register.
-    if (una_at_ctx.read_register_callback != NULL) {
-        // Execute read callback.
-        status = una_at_ctx.read_register_callback((uint8_t) reg_addr, &reg_value);
-        if (status != AT_SUCCESS) goto errors;
-    }
-    else {
-        status = AT_ERROR_COMMAND_EXECUTION;
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    // Nothing to monitor when the bus is already running at the default baud rate.
+    if ((una_at_ctx.baud_rate_monitor_flag == 0) || (una_at_ctx.baud_rate == una_at_ctx.baud_rate_default)) goto errors;
+    // An ERROR reply proves that the link is working.
+    if (((access_status->flags) == 0) || ((access_status->error_received) != 0)) {
+        una_at_ctx.baud_rate_error_count = 0;
         goto errors;
     }
-    // Send reply.
-    _UNA_AT_tx_buffer_add_register(reg_value);
-    AT_send_reply();
+    una_at_ctx.baud_rate_error_count++;
+    // Fall back to the default baud rate when errors accumulate.
+    // The broadcast is sent at the failing baud rate so it is best effort: the nodes which miss it recover with their silence timeout.
+    if (una_at_ctx.baud_rate_error_count >= UNA_AT_BAUD_RATE_ERROR_THRESHOLD) {
+        status = _UNA_AT_switch_baud_rate(una_at_ctx.baud_rate_default);
+        if (status != UNA_AT_SUCCESS) goto errors;
+    }
 errors:
     return status;
 }
 #endif
 
-/*** AT functions ***/
-
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_access(UNA_node_address_t node_address, UNA_reply_parameters_t* reply_params, UNA_AT_line_cb_t line_callback, uint32_t* reg_value, UNA_access_status_t* access_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
+    uint32_t retry_count = 0;
+#endif
+#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
+    for (retry_count = 0; retry_count < UNA_AT_NODE_ACCESS_RETRY_MAX; retry_count++) {
+#endif
+        // Send command.
+        status = _UNA_AT_send(node_address);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Wait reply.
+        status = _UNA_AT_wait_reply(reply_params, line_callback, reg_value, access_status);
+        if (status != UNA_AT_SUCCESS) goto errors;
+#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
+        // Exit on first success.
+        if (access_status->flags == 0) break;
+    }
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    status = _UNA_AT_check_baud_rate(access_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && ((defined UNA_AT_COMPARE_AND_SWAP) || (defined UNA_AT_CONDITIONAL_WAIT) || (defined UNA_AT_GATEWAY_FORWARDING)))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_access_once(UNA_node_address_t node_address, UNA_reply_parameters_t* reply_params, UNA_AT_line_cb_t line_callback, uint32_t* reg_value, UNA_access_status_t* access_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    // Send command.
+    status = _UNA_AT_send(node_address);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Wait reply.
+    status = _UNA_AT_wait_reply(reply_params, line_callback, reg_value, access_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    status = _UNA_AT_check_baud_rate(access_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+static void _UNA_AT_read_block_line_callback(PARSER_context_t* parser) {
+    // Local variables.
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t chunk_offset = 0;
+    uint32_t chunk_size = 0;
+    uint32_t extracted_size = 0;
+    uint32_t crc = 0;
+    uint8_t chunk_idx = 0;
+    // Parse chunk offset.
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_COMMA, &chunk_offset);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    // Check offset range and alignment.
+    if ((chunk_offset < una_at_ctx.block.offset) || (chunk_offset >= (una_at_ctx.block.offset + una_at_ctx.block.size))) goto errors;
+    if (((chunk_offset - una_at_ctx.block.offset) % una_at_ctx.block.chunk_size) != 0) goto errors;
+    chunk_idx = (uint8_t) ((chunk_offset - una_at_ctx.block.offset) / una_at_ctx.block.chunk_size);
+    // Compute expected chunk size.
+    chunk_size = (una_at_ctx.block.offset + una_at_ctx.block.size - chunk_offset);
+    if (chunk_size > una_at_ctx.block.chunk_size) {
+        chunk_size = una_at_ctx.block.chunk_size;
+    }
+    // Parse data directly in the destination buffer.
+    parser_status = PARSER_get_byte_array(parser, STRING_CHAR_COMMA, chunk_size, 1, &(una_at_ctx.block.data[chunk_offset - una_at_ctx.block.offset]), &extracted_size);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    // Parse and check CRC.
+    parser_status = SWREG_parse_register(parser, STRING_CHAR_NULL, &crc);
+    if (parser_status != PARSER_SUCCESS) goto errors;
+    if (crc != _UNA_AT_compute_crc(&(una_at_ctx.block.data[chunk_offset - una_at_ctx.block.offset]), chunk_size)) goto errors;
+    // Acknowledge chunk.
+    una_at_ctx.block.chunk_bitmap |= (((uint32_t) 0b1) << chunk_idx);
+errors:
+    return;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_read_block_request(UNA_access_parameters_t* read_params, uint32_t offset, uint32_t size, UNA_access_status_t* read_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    uint32_t unused_reg_value = 0;
+    // Build read block command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_READ_BLOCK);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) (read_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, offset);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, size);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, (uint32_t) una_at_ctx.block.chunk_size);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Add ending marker.
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Chunks lines are terminated by the OK status.
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = (read_params->reply_params.timeout_ms);
+    // Perform access.
+    status = _UNA_AT_access((read_params->node_addr), &reply_params, &_UNA_AT_read_block_line_callback, &unused_reg_value, read_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static AT_status_t _UNA_AT_execute_write(uint32_t* reg_addr) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Read address parameter.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // First try with 3 parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &reg_value);
+    if (parser_status == PARSER_SUCCESS) {
+        // Try parsing register mask parameter.
+        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_mask);
+        PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    }
+    else {
+        // Try with only 2 parameters.
+        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_value);
+        PARSER_exit_error(AT_ERROR_BASE_PARSER);
+        // Perform full write operation since mask is not given.
+        reg_mask = UNA_REGISTER_MASK_ALL;
+    }
+    // Write register.
+    if (una_at_ctx.write_register_callback != NULL) {
+        // Execute write callback.
+        status = una_at_ctx.write_register_callback((uint8_t) (*reg_addr), reg_value, reg_mask);
+        if (status != AT_SUCCESS) goto errors;
+#ifdef UNA_AT_DIRTY_REGISTERS
+        // The applied value may differ from the written one.
+        UNA_AT_set_dirty_register((uint8_t) (*reg_addr));
+#endif
+    }
+    else {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static AT_status_t _UNA_AT_write_register_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint32_t reg_addr = 0;
+#ifdef UNA_AT_GATEWAY_FORWARDING
+    // Registers of the downstream nodes are written through the downstream bus.
+    if (una_at_ctx.forward_flag != 0) {
+        status = _UNA_AT_gateway_write_register();
+        goto errors;
+    }
+#endif
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Write register.
+    status = _UNA_AT_execute_write(&reg_addr);
+    if (status != AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_WRITE_READ))
+/*******************************************************************/
+static AT_status_t _UNA_AT_write_read_register_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Write register.
+    status = _UNA_AT_execute_write(&reg_addr);
+    if (status != AT_SUCCESS) goto errors;
+    // Read back register to return the applied value.
+    if (una_at_ctx.read_register_callback != NULL) {
+        // Execute read callback.
+        status = una_at_ctx.read_register_callback((uint8_t) reg_addr, &reg_value);
+        if (status != AT_SUCCESS) goto errors;
+    }
+    else {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Send reply.
+    _UNA_AT_reply_add_register(reg_value);
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_COMPARE_AND_SWAP))
+/*******************************************************************/
+static AT_status_t _UNA_AT_compare_and_swap_register_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_addr = 0;
+    uint32_t expected_value = 0;
+    uint32_t new_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t old_value = 0;
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Read parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &expected_value);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // First try with 4 parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &new_value);
+    if (parser_status == PARSER_SUCCESS) {
+        // Try parsing register mask parameter.
+        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_mask);
+        PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    }
+    else {
+        // Try with only 3 parameters.
+        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &new_value);
+        PARSER_exit_error(AT_ERROR_BASE_PARSER);
+        reg_mask = UNA_REGISTER_MASK_ALL;
+    }
+    // Check callbacks.
+    if ((una_at_ctx.read_register_callback == NULL) || (una_at_ctx.write_register_callback == NULL)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Commands are processed one at a time, so no other bus access can occur between read and write.
+    status = una_at_ctx.read_register_callback((uint8_t) reg_addr, &old_value);
+    if (status != AT_SUCCESS) goto errors;
+    // Swap only if the masked value is the expected one.
+    if (((old_value ^ expected_value) & reg_mask) == 0) {
+        status = una_at_ctx.write_register_callback((uint8_t) reg_addr, new_value, reg_mask);
+        if (status != AT_SUCCESS) goto errors;
+#ifdef UNA_AT_DIRTY_REGISTERS
+        UNA_AT_set_dirty_register((uint8_t) reg_addr);
+#endif
+    }
+    // Send old value.
+    _UNA_AT_reply_add_register(old_value);
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_SLAVE
+/*******************************************************************/
+static AT_status_t _UNA_AT_read_register_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+#ifdef UNA_AT_IRQ_READ
+    // Nothing to do when the reply has already been sent from the reception context.
+    if (una_at_ctx.irq_read_done_flag != 0) goto errors;
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+    // Registers of the downstream nodes are read through the downstream bus.
+    if (una_at_ctx.forward_flag != 0) {
+        status = _UNA_AT_gateway_read_register();
+        goto errors;
+    }
+#endif
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Read address parameter.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Read register.
+#ifdef UNA_AT_SNAPSHOT
+    if ((reg_addr - una_at_ctx.latch_reg_addr) < una_at_ctx.latch_reg_count) {
+        // Serve latched registers from the shadow buffer.
+        reg_value = una_at_ctx.latch_value[reg_addr - una_at_ctx.latch_reg_addr];
+    }
+    else if (una_at_ctx.read_register_callback != NULL) {
+#else
+    if (una_at_ctx.read_register_callback != NULL) {
+#endif
+        // Execute read callback.
+        status = una_at_ctx.read_register_callback((uint8_t) reg_addr, &reg_value);
+        if (status != AT_SUCCESS) goto errors;
+    }
+    else {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Send reply.
+    _UNA_AT_reply_add_register(reg_value);
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_GATEWAY_FORWARDING) && (UNA_AT_GATEWAY_CACHE_SIZE > 0))
+/*******************************************************************/
+static UNA_AT_gateway_cache_entry_t* _UNA_AT_gateway_cache_search(UNA_node_address_t node_addr, uint8_t reg_addr) {
+    // Local variables.
+    UNA_AT_gateway_cache_entry_t* cache_entry = NULL;
+    uint8_t idx = 0;
+    // Entries loop.
+    for (idx = 0; idx < UNA_AT_GATEWAY_CACHE_SIZE; idx++) {
+        if ((una_at_ctx.gateway_cache[idx].valid_flag != 0) && (una_at_ctx.gateway_cache[idx].node_addr == node_addr) && (una_at_ctx.gateway_cache[idx].reg_addr == reg_addr)) {
+            cache_entry = &(una_at_ctx.gateway_cache[idx]);
+            break;
+        }
+    }
+    return cache_entry;
+}
+#endif
+
+#if ((defined UNA_AT_GATEWAY_FORWARDING) && (UNA_AT_GATEWAY_CACHE_SIZE > 0))
+/*******************************************************************/
+static void _UNA_AT_gateway_cache_update(UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t tick_ms) {
+    // Local variables.
+    UNA_AT_gateway_cache_entry_t* cache_entry = _UNA_AT_gateway_cache_search(node_addr, reg_addr);
+    uint8_t idx = 0;
+    // Allocate a new entry if the register is not cached yet.
+    if (cache_entry == NULL) {
+        cache_entry = &(una_at_ctx.gateway_cache[0]);
+        for (idx = 0; idx < UNA_AT_GATEWAY_CACHE_SIZE; idx++) {
+            // Use the first free entry, or evict the oldest one.
+            if (una_at_ctx.gateway_cache[idx].valid_flag == 0) {
+                cache_entry = &(una_at_ctx.gateway_cache[idx]);
+                break;
+            }
+            if ((tick_ms - una_at_ctx.gateway_cache[idx].update_tick_ms) > (tick_ms - (cache_entry->update_tick_ms))) {
+                cache_entry = &(una_at_ctx.gateway_cache[idx]);
+            }
+        }
+    }
+    // Update entry.
+    cache_entry->valid_flag = 1;
+    cache_entry->node_addr = node_addr;
+    cache_entry->reg_addr = reg_addr;
+    cache_entry->reg_value = reg_value;
+    cache_entry->update_tick_ms = tick_ms;
+}
+#endif
+
+#ifdef UNA_AT_GATEWAY_FORWARDING
+/*******************************************************************/
+static AT_status_t _UNA_AT_gateway_write_register(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    UNA_AT_status_t una_at_status = UNA_AT_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    UNA_access_status_t write_status;
+    UNA_node_address_t node_addr = una_at_ctx.forward_node_addr;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t unused_reg_value = 0;
+#if (UNA_AT_GATEWAY_CACHE_SIZE > 0)
+    UNA_AT_gateway_cache_entry_t* cache_entry = NULL;
+#endif
+    // The master node can not be accessed through the downstream bus.
+    if (node_addr == UNA_NODE_ADDRESS_MASTER) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Read parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // First try with 3 parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &reg_value);
+    if (parser_status == PARSER_SUCCESS) {
+        // Try parsing register mask parameter.
+        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_mask);
+        PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    }
+    else {
+        // Try with only 2 parameters.
+        parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_value);
+        PARSER_exit_error(AT_ERROR_BASE_PARSER);
+        reg_mask = UNA_REGISTER_MASK_ALL;
+    }
+#if (UNA_AT_GATEWAY_CACHE_SIZE > 0)
+    // The applied value may differ from the written one, so the entry is dropped rather than updated.
+    cache_entry = _UNA_AT_gateway_cache_search(node_addr, (uint8_t) reg_addr);
+    if (cache_entry != NULL) {
+        cache_entry->valid_flag = 0;
+    }
+#endif
+    // Forward write operation on the downstream bus.
+    (write_status.all) = 0;
+    (write_status.type) = UNA_ACCESS_TYPE_WRITE;
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = UNA_AT_GATEWAY_ACCESS_TIMEOUT_MS;
+    una_at_status = _UNA_AT_build_write_command(UNA_AT_COMMAND_WRITE_REGISTER, (uint8_t) reg_addr, reg_value, reg_mask);
+    if (una_at_status != UNA_AT_SUCCESS) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Single attempt, the upstream master node performs the retries.
+    una_at_status = _UNA_AT_access_once(node_addr, &reply_params, NULL, &unused_reg_value, &write_status);
+    if ((una_at_status != UNA_AT_SUCCESS) || (write_status.flags != 0)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_GATEWAY_FORWARDING
+/*******************************************************************/
+static AT_status_t _UNA_AT_gateway_read_register(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    UNA_AT_status_t una_at_status = UNA_AT_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    UNA_access_status_t read_status;
+    UNA_node_address_t node_addr = una_at_ctx.forward_node_addr;
+    uint32_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    uint8_t cache_hit = 0;
+#if (UNA_AT_GATEWAY_CACHE_SIZE > 0)
+    UNA_AT_gateway_cache_entry_t* cache_entry = NULL;
+    uint32_t tick_ms = 0;
+#endif
+    // The master node can not be accessed through the downstream bus.
+    if (node_addr == UNA_NODE_ADDRESS_MASTER) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Read address parameter.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+#if (UNA_AT_GATEWAY_CACHE_SIZE > 0)
+    // Serve the request locally if the cached value is still valid.
+    una_at_status = _UNA_AT_get_tick_ms(&tick_ms);
+    if (una_at_status != UNA_AT_SUCCESS) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    cache_entry = _UNA_AT_gateway_cache_search(node_addr, (uint8_t) reg_addr);
+    if ((cache_entry != NULL) && ((tick_ms - (cache_entry->update_tick_ms)) < UNA_AT_GATEWAY_CACHE_VALIDITY_MS)) {
+        reg_value = (cache_entry->reg_value);
+        cache_hit = 1;
+        // Delay to ensure that the master node has switched to RX.
+        _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    }
+#endif
+    if (cache_hit == 0) {
+        // Forward read operation on the downstream bus.
+        (read_status.all) = 0;
+        (read_status.type) = UNA_ACCESS_TYPE_READ;
+        reply_params.type = UNA_REPLY_TYPE_VALUE;
+        reply_params.timeout_ms = UNA_AT_GATEWAY_ACCESS_TIMEOUT_MS;
+        una_at_status = _UNA_AT_build_read_command((uint8_t) reg_addr);
+        if (una_at_status != UNA_AT_SUCCESS) {
+            status = AT_ERROR_COMMAND_EXECUTION;
+            goto errors;
+        }
+        // Single attempt, the upstream master node performs the retries.
+        una_at_status = _UNA_AT_access_once(node_addr, &reply_params, NULL, &reg_value, &read_status);
+        if ((una_at_status != UNA_AT_SUCCESS) || (read_status.flags != 0)) {
+            status = AT_ERROR_COMMAND_EXECUTION;
+            goto errors;
+        }
+#if (UNA_AT_GATEWAY_CACHE_SIZE > 0)
+        _UNA_AT_gateway_cache_update(node_addr, (uint8_t) reg_addr, reg_value, tick_ms);
+#endif
+    }
+    // Send reply.
+    _UNA_AT_reply_add_register(reg_value);
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static AT_status_t _UNA_AT_set_baud_rate_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t baud_rate = 0;
+    UNA_AT_reject_forwarded_command();
+    // Read baud rate parameter.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &baud_rate);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Check parameter and callback.
+    if ((baud_rate == 0) || (una_at_ctx.baud_rate_callback == NULL)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Baud rate is changed in the process function, once the reply has been sent.
+    una_at_ctx.at_baud_rate_pending = baud_rate;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static uint8_t _UNA_AT_match_command(char_t* line, const char_t* syntax) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Compare line with the command syntax.
+    for (idx = 0; syntax[idx] != STRING_CHAR_NULL; idx++) {
+        if (line[idx] != syntax[idx]) break;
+    }
+    return ((syntax[idx] == STRING_CHAR_NULL) ? 1 : 0);
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static uint8_t _UNA_AT_is_command_known(void) {
+    // Local variables.
+    uint8_t command_known_flag = 0;
+    char_t* line = (una_at_ctx.at_parser_ptr->buffer);
+    uint32_t cmd_idx = 0;
+    // Check command header.
+    if (_UNA_AT_match_command(line, UNA_AT_COMMAND_HEADER) == 0) goto errors;
+    line += (sizeof(UNA_AT_COMMAND_HEADER) - 1);
+    // Garbage received at a wrong baud rate is very unlikely to match a command syntax.
+    for (cmd_idx = 0; cmd_idx < (sizeof(UNA_AT_COMMANDS_LIST) / sizeof(AT_command_t)); cmd_idx++) {
+        if (_UNA_AT_match_command(line, UNA_AT_COMMANDS_LIST[cmd_idx].syntax) != 0) {
+            command_known_flag = 1;
+            goto errors;
+        }
+    }
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    for (cmd_idx = 0; cmd_idx < UNA_AT_CUSTOM_COMMANDS_NUMBER; cmd_idx++) {
+        if ((una_at_ctx.custom_command[cmd_idx] != NULL) && (_UNA_AT_match_command(line, una_at_ctx.custom_command[cmd_idx]->syntax) != 0)) {
+            command_known_flag = 1;
+            goto errors;
+        }
+    }
+#endif
+errors:
+    return command_known_flag;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_update_baud_rate(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    uint32_t tick_ms = 0;
+    // Read current time.
+    status = _UNA_AT_get_tick_ms(&tick_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Check pending request.
+    if (una_at_ctx.at_baud_rate_pending != 0) {
+        // Wait for the end of the reply transmission.
+        status = _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        una_at_ctx.at_baud_rate = una_at_ctx.at_baud_rate_pending;
+        una_at_ctx.at_baud_rate_pending = 0;
+        una_at_ctx.at_command_tick_ms = tick_ms;
+        una_at_ctx.baud_rate_callback(una_at_ctx.at_baud_rate);
+    }
+    // Go back to the default baud rate if the master is not heard anymore.
+    if ((una_at_ctx.at_baud_rate != una_at_ctx.at_baud_rate_default) && ((tick_ms - una_at_ctx.at_command_tick_ms) > UNA_AT_BAUD_RATE_SILENCE_TIMEOUT_MS)) {
+        una_at_ctx.at_baud_rate = una_at_ctx.at_baud_rate_default;
+        una_at_ctx.baud_rate_callback(una_at_ctx.at_baud_rate);
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+static AT_status_t _UNA_AT_write_block_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t block_addr = 0;
+    uint32_t offset = 0;
+    uint32_t chunk_size = 0;
+    uint32_t crc = 0;
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Read parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &block_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &offset);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = PARSER_get_byte_array(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES, 0, una_at_ctx.block_chunk, &chunk_size);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &crc);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Check chunk integrity.
+    if (crc != _UNA_AT_compute_crc(una_at_ctx.block_chunk, chunk_size)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Write block chunk.
+    if (una_at_ctx.write_block_callback != NULL) {
+        // Execute write callback.
+        status = una_at_ctx.write_block_callback((uint8_t) block_addr, offset, una_at_ctx.block_chunk, chunk_size);
+        if (status != AT_SUCCESS) goto errors;
+    }
+    else {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+static AT_status_t _UNA_AT_read_block_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t block_addr = 0;
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    uint32_t chunk_size = 0;
+    uint32_t chunk_offset = 0;
+    uint32_t chunk_length = 0;
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Read parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &block_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &offset);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &size);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &chunk_size);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Check parameters.
+    if ((chunk_size == 0) || (chunk_size > UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES) || (una_at_ctx.read_block_callback == NULL)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Stream all chunks of the window.
+    for (chunk_offset = offset; chunk_offset < (offset + size); chunk_offset += chunk_size) {
+        // Compute chunk length.
+        chunk_length = (offset + size - chunk_offset);
+        if (chunk_length > chunk_size) {
+            chunk_length = chunk_size;
+        }
+        // Execute read callback.
+        status = una_at_ctx.read_block_callback((uint8_t) block_addr, chunk_offset, una_at_ctx.block_chunk, chunk_length);
+        if (status != AT_SUCCESS) goto errors;
+        // Send chunk line.
+        _UNA_AT_reply_add_register(chunk_offset);
+        AT_reply_add_string(UNA_AT_REPLY_SEPARATOR);
+        AT_reply_add_byte_array(una_at_ctx.block_chunk, chunk_length, 0);
+        AT_reply_add_string(UNA_AT_REPLY_SEPARATOR);
+        _UNA_AT_reply_add_register((uint32_t) _UNA_AT_compute_crc(una_at_ctx.block_chunk, chunk_length));
+        AT_send_reply();
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+/*******************************************************************/
+static AT_status_t _UNA_AT_read_notifications_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint8_t idx = una_at_ctx.notification_read_idx;
+    uint8_t write_idx = una_at_ctx.notification_write_idx;
+    UNA_AT_reject_forwarded_command();
+    // Notifications are only dequeued on acknowledge, so an unacknowledged read sends them again.
+    una_at_ctx.notification_sent_count = 0;
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Send one line per pending notification.
+    while (idx != write_idx) {
+        AT_reply_add_string(UNA_AT_NOTIFICATION_HEADER);
+        _UNA_AT_reply_add_register((uint32_t) una_at_ctx.notification_queue[idx].reg_addr);
+        AT_reply_add_string(UNA_AT_REPLY_SEPARATOR);
+        _UNA_AT_reply_add_register(una_at_ctx.notification_queue[idx].reg_value);
+        AT_send_reply();
+        una_at_ctx.notification_sent_count++;
+        idx = (uint8_t) ((idx + 1) % UNA_AT_NOTIFICATION_QUEUE_SIZE);
+    }
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+/*******************************************************************/
+static AT_status_t _UNA_AT_acknowledge_notifications_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    UNA_AT_reject_forwarded_command();
+    // Dequeue the notifications received by the master.
+    una_at_ctx.notification_read_idx = (uint8_t) ((una_at_ctx.notification_read_idx + una_at_ctx.notification_sent_count) % UNA_AT_NOTIFICATION_QUEUE_SIZE);
+    una_at_ctx.notification_sent_count = 0;
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_DIRTY_REGISTERS))
+/*******************************************************************/
+static AT_status_t _UNA_AT_read_dirty_registers_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint32_t reg_value = 0;
+    uint16_t reg_addr = 0;
+    uint32_t reg_bit = 0;
+    uint8_t idx = 0;
+    UNA_AT_reject_forwarded_command();
+    // Check callback.
+    if (una_at_ctx.read_register_callback == NULL) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Registers sent by a previous unacknowledged synchronization may not have been received.
+    for (reg_addr = 0; reg_addr < UNA_AT_DIRTY_REGISTERS_NUMBER; reg_addr++) {
+        if ((una_at_ctx.dirty_sent_bitmap[reg_addr / 32] & (((uint32_t) 0b1) << (reg_addr % 32))) != 0) {
+            una_at_ctx.dirty_flag[reg_addr] = 1;
+        }
+    }
+    for (idx = 0; idx < UNA_AT_DIRTY_BITMAP_SIZE; idx++) {
+        una_at_ctx.dirty_sent_bitmap[idx] = 0;
+    }
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Registers loop.
+    for (reg_addr = 0; reg_addr < UNA_AT_DIRTY_REGISTERS_NUMBER; reg_addr++) {
+        // Skip clean registers.
+        reg_bit = (((uint32_t) 0b1) << (reg_addr % 32));
+        if (una_at_ctx.dirty_flag[reg_addr] == 0) continue;
+        // Clear flag before reading so that a concurrent modification is reported on next synchronization.
+        una_at_ctx.dirty_flag[reg_addr] = 0;
+        una_at_ctx.dirty_sent_bitmap[reg_addr / 32] |= reg_bit;
+        // Read register.
+        status = una_at_ctx.read_register_callback((uint8_t) reg_addr, &reg_value);
+        if (status != AT_SUCCESS) {
+            una_at_ctx.dirty_flag[reg_addr] = 1;
+            una_at_ctx.dirty_sent_bitmap[reg_addr / 32] &= (~reg_bit);
+            goto errors;
+        }
+        // Send register line.
+        _UNA_AT_reply_add_register((uint32_t) reg_addr);
+        AT_reply_add_string(UNA_AT_REPLY_SEPARATOR);
+        _UNA_AT_reply_add_register(reg_value);
+        AT_send_reply();
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_DIRTY_REGISTERS))
+/*******************************************************************/
+static AT_status_t _UNA_AT_acknowledge_dirty_registers_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    uint8_t idx = 0;
+    UNA_AT_reject_forwarded_command();
+    // Sent registers have been received by the master.
+    for (idx = 0; idx < UNA_AT_DIRTY_BITMAP_SIZE; idx++) {
+        una_at_ctx.dirty_sent_bitmap[idx] = 0;
+    }
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_SNAPSHOT))
+/*******************************************************************/
+static AT_status_t _UNA_AT_latch_registers_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_addr = 0;
+    uint32_t reg_count = 0;
+    uint32_t idx = 0;
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Read parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &reg_count);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Release previous snapshot.
+    una_at_ctx.latch_reg_count = 0;
+    // Check range and callback.
+    if ((reg_count == 0) || (reg_count > UNA_AT_SNAPSHOT_REGISTERS_NUMBER) || ((reg_addr + reg_count) > 0x100) || (una_at_ctx.read_register_callback == NULL)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Commands are processed one at a time, so no bus access can modify the registers during the latch.
+    for (idx = 0; idx < reg_count; idx++) {
+        status = una_at_ctx.read_register_callback((uint8_t) (reg_addr + idx), &(una_at_ctx.latch_value[idx]));
+        if (status != AT_SUCCESS) goto errors;
+    }
+    una_at_ctx.latch_reg_addr = (uint8_t) reg_addr;
+    una_at_ctx.latch_reg_count = (uint8_t) reg_count;
+    // Send registers lines.
+    for (idx = 0; idx < reg_count; idx++) {
+        _UNA_AT_reply_add_register(reg_addr + idx);
+        AT_reply_add_string(UNA_AT_REPLY_SEPARATOR);
+        _UNA_AT_reply_add_register(una_at_ctx.latch_value[idx]);
+        AT_send_reply();
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_SNAPSHOT))
+/*******************************************************************/
+static AT_status_t _UNA_AT_release_registers_callback(void) {
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Registers are read through the callback again.
+    una_at_ctx.latch_reg_count = 0;
+    return AT_SUCCESS;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_CONDITIONAL_WAIT))
+/*******************************************************************/
+static AT_status_t _UNA_AT_conditional_wait_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    UNA_AT_status_t una_at_status = UNA_AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    uint32_t reg_addr = 0;
+    UNA_AT_reject_forwarded_command();
+    // Delay to ensure that the master node has switched to RX.
+    _UNA_AT_delay_milliseconds(UNA_AT_REPLY_DELAY_MS);
+    // Read parameters.
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &reg_addr);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &(una_at_ctx.wait_reg_mask));
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, UNA_AT_PARAMETER_SEPARATOR, &(una_at_ctx.wait_expected_value));
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = SWREG_parse_register(una_at_ctx.at_parser_ptr, STRING_CHAR_NULL, &(una_at_ctx.wait_duration_ms));
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Check callback.
+    if (una_at_ctx.read_register_callback == NULL) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Start wait.
+    una_at_status = _UNA_AT_get_tick_ms(&(una_at_ctx.wait_start_tick_ms));
+    if (una_at_status != UNA_AT_SUCCESS) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // The condition is evaluated by the process function after the OK status.
+    una_at_ctx.wait_reg_addr = (uint8_t) reg_addr;
+    una_at_ctx.wait_flag = 1;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_CONDITIONAL_WAIT))
+/*******************************************************************/
+static UNA_AT_status_t _UNA_AT_process_conditional_wait(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    AT_status_t at_status = AT_SUCCESS;
+    uint32_t tick_ms = 0;
+    uint32_t reg_value = 0;
+    // Check pending wait.
+    if (una_at_ctx.wait_flag == 0) goto errors;
+    // Read current time and register.
+    status = _UNA_AT_get_tick_ms(&tick_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    at_status = una_at_ctx.read_register_callback(una_at_ctx.wait_reg_addr, &reg_value);
+    if (at_status != AT_SUCCESS) {
+        // Stop waiting and report the failure to the master instead of letting it wait until its timeout.
+        una_at_ctx.wait_flag = 0;
+        AT_reply_add_string(UNA_AT_REPLY_ERROR);
+        AT_send_reply();
+        goto errors;
+    }
+    // Keep waiting while the condition is false and the wait has not expired.
+    if ((((reg_value ^ una_at_ctx.wait_expected_value) & una_at_ctx.wait_reg_mask) != 0) && ((tick_ms - una_at_ctx.wait_start_tick_ms) < una_at_ctx.wait_duration_ms)) goto errors;
+    // Send current value.
+    una_at_ctx.wait_flag = 0;
+    _UNA_AT_reply_add_register(reg_value);
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+/*** AT functions ***/
+
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_init(UNA_AT_configuration_t* configuration) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+#ifdef UNA_AT_MODE_SLAVE
+    AT_status_t at_status = AT_SUCCESS;
+    AT_configuration_t at_config;
+    uint32_t idx = 0;
+#endif
+    // Check parameter.
+    if (configuration == NULL) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Init context.
+#ifdef UNA_AT_MODE_MASTER
+    _UNA_AT_flush_replies();
+    una_at_ctx.reply_drain_flag = 0;
+#ifdef UNA_AT_NOTIFICATIONS
+    una_at_ctx.notification_callback = (configuration->notification_callback);
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    una_at_ctx.baud_rate_default = (configuration->baud_rate);
+    una_at_ctx.baud_rate = (configuration->baud_rate);
+    una_at_ctx.baud_rate_error_count = 0;
+    una_at_ctx.baud_rate_monitor_flag = 1;
+#endif
+#endif
+#ifdef UNA_AT_MODE_SLAVE
+    una_at_ctx.at_process_flag = 0;
+    una_at_ctx.process_callback = (configuration->process_callback);
+    una_at_ctx.write_register_callback = (configuration->write_register_callback);
+    una_at_ctx.read_register_callback = (configuration->read_register_callback);
+#ifdef UNA_AT_BLOCK_TRANSFER
+    una_at_ctx.write_block_callback = (configuration->write_block_callback);
+    una_at_ctx.read_block_callback = (configuration->read_block_callback);
+#endif
+#ifdef UNA_AT_NOTIFICATIONS
+    una_at_ctx.notification_write_idx = 0;
+    una_at_ctx.notification_read_idx = 0;
+    una_at_ctx.notification_sent_count = 0;
+#endif
+#ifdef UNA_AT_DIRTY_REGISTERS
+    // All registers are unknown to the master at startup.
+    for (idx = 0; idx < UNA_AT_DIRTY_REGISTERS_NUMBER; idx++) {
+        una_at_ctx.dirty_flag[idx] = 1;
+    }
+    for (idx = 0; idx < UNA_AT_DIRTY_BITMAP_SIZE; idx++) {
+        una_at_ctx.dirty_sent_bitmap[idx] = 0;
+    }
+#endif
+#ifdef UNA_AT_IRQ_READ
+    // No register is IRQ-safe until its first snapshot.
+    for (idx = 0; idx < UNA_AT_IRQ_READ_BITMAP_SIZE; idx++) {
+        una_at_ctx.irq_read_bitmap[idx] = 0;
+    }
+    una_at_ctx.irq_read_done_flag = 0;
+    una_at_ctx.at_busy_flag = 0;
+    una_at_ctx.irq_read_line_size = 0;
+#endif
+#ifdef UNA_AT_SNAPSHOT
+    una_at_ctx.latch_reg_addr = 0;
+    una_at_ctx.latch_reg_count = 0;
+#endif
+#ifdef UNA_AT_CONDITIONAL_WAIT
+    una_at_ctx.wait_flag = 0;
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    una_at_ctx.baud_rate_callback = (configuration->baud_rate_callback);
+    una_at_ctx.at_baud_rate_default = (configuration->default_baud_rate);
+    una_at_ctx.at_baud_rate = (configuration->default_baud_rate);
+    una_at_ctx.at_baud_rate_pending = 0;
+    una_at_ctx.at_command_tick_ms = 0;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    for (idx = 0; idx < UNA_AT_CUSTOM_COMMANDS_NUMBER; idx++) {
+        una_at_ctx.custom_command[idx] = NULL;
+    }
+#endif
+#endif
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+    una_at_ctx.gateway_node_addr = (configuration->node_addr);
+    una_at_ctx.forward_node_addr = (configuration->node_addr);
+    una_at_ctx.forward_flag = 0;
+#endif
+#if ((defined UNA_AT_GATEWAY_FORWARDING) && (UNA_AT_GATEWAY_CACHE_SIZE > 0))
+    for (idx = 0; idx < UNA_AT_GATEWAY_CACHE_SIZE; idx++) {
+        una_at_ctx.gateway_cache[idx].valid_flag = 0;
+    }
+#endif
+    // Init low level interface.
+#ifdef UNA_AT_MODE_MASTER
+    // Init bus terminal.
+    status = _UNA_AT_open_bus(configuration->baud_rate);
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+#ifdef UNA_AT_MODE_SLAVE
+    // Init AT receiver.
+    at_config.process_callback = &_UNA_AT_at_process_callback;
+    at_config.terminal_instance = UNA_AT_TERMINAL_INSTANCE;
+    at_status = AT_init(&at_config, &(una_at_ctx.at_parser_ptr));
+    AT_exit_error(UNA_AT_ERROR_BASE_AT);
+    // Register commands.
+    for (idx = 0; idx < (sizeof(UNA_AT_COMMANDS_LIST) / sizeof(AT_command_t)); idx++) {
+        at_status = AT_register_command(&(UNA_AT_COMMANDS_LIST[idx]));
+        AT_exit_error(UNA_AT_ERROR_BASE_AT);
+    }
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    *(configuration->parser_context_ptr) = una_at_ctx.at_parser_ptr;
+#endif
+#endif
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_de_init(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+#ifdef UNA_AT_MODE_SLAVE
+    AT_status_t at_status = AT_SUCCESS;
+    uint8_t idx = 0;
+#endif
+    // Release low level interface.
+#ifdef UNA_AT_MODE_MASTER
+    status = _UNA_AT_close_bus();
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+#ifdef UNA_AT_MODE_SLAVE
+    // Unregister commands.
+    for (idx = 0; idx < (sizeof(UNA_AT_COMMANDS_LIST) / sizeof(AT_command_t)); idx++) {
+        AT_unregister_command(&(UNA_AT_COMMANDS_LIST[idx]));
+    }
+    // Init AT receiver.
+    at_status = AT_de_init();
+    AT_exit_error(UNA_AT_ERROR_BASE_AT);
+#endif
+errors:
+    return status;
+}
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_send_command(UNA_command_parameters_t* command_params) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Add command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, (command_params->command));
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Add ending marker.
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Send command.
+    status = _UNA_AT_send(command_params->node_addr);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_REPLY_STREAMING))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_send_command_stream(UNA_command_parameters_t* command_params, uint32_t timeout_ms, UNA_AT_reply_line_cb_t line_callback, UNA_access_status_t* command_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    uint32_t unused_reg_value = 0;
+    // Check parameters.
+    if ((command_params == NULL) || (line_callback == NULL) || (command_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status.
+    (command_status->all) = 0;
+    // Send command (without retry since it may not be idempotent).
+    status = UNA_AT_send_command(command_params);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Stream reply lines until the OK or ERROR status.
+    una_at_ctx.reply_line_callback = line_callback;
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = timeout_ms;
+    status = _UNA_AT_wait_reply(&reply_params, &_UNA_AT_stream_line_callback, &unused_reg_value, command_status);
+    una_at_ctx.reply_line_callback = NULL;
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    uint32_t unused_reg_value = 0;
+    // Check parameters.
+    if ((write_params == NULL) || (write_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status.
+    (write_status->all) = 0;
+    (write_status->type) = UNA_ACCESS_TYPE_WRITE;
+    // Build write command.
+    status = _UNA_AT_build_write_command(UNA_AT_COMMAND_WRITE_REGISTER, (write_params->reg_addr), reg_value, reg_mask);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Perform access.
+    status = _UNA_AT_access((write_params->node_addr), &(write_params->reply_params), NULL, &unused_reg_value, write_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_MODE_MASTER
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    // Check parameters.
+    if ((read_params == NULL) || (read_status == NULL) || (reg_value == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status.
+    (read_status->all) = 0;
+    (read_status->type) = UNA_ACCESS_TYPE_READ;
+    // Build read command.
+    status = _UNA_AT_build_read_command(read_params->reg_addr);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Perform access.
+    status = _UNA_AT_access((read_params->node_addr), &(read_params->reply_params), NULL, reg_value, read_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_WRITE_READ))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_write_read_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, uint32_t* read_value, UNA_access_status_t* write_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    // Check parameters.
+    if ((write_params == NULL) || (read_value == NULL) || (write_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status.
+    (write_status->all) = 0;
+    (write_status->type) = UNA_ACCESS_TYPE_WRITE;
+    // Build write command.
+    status = _UNA_AT_build_write_command(UNA_AT_COMMAND_WRITE_READ, (write_params->reg_addr), reg_value, reg_mask);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // The applied value is returned instead of the OK status.
+    reply_params.type = UNA_REPLY_TYPE_VALUE;
+    reply_params.timeout_ms = (write_params->reply_params.timeout_ms);
+    // Perform access.
+    status = _UNA_AT_access((write_params->node_addr), &reply_params, NULL, read_value, write_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_COMPARE_AND_SWAP))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_compare_and_swap_register(UNA_access_parameters_t* cas_params, uint32_t expected_value, uint32_t new_value, uint32_t reg_mask, uint32_t* old_value, uint8_t* swap_done, UNA_access_status_t* cas_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    // Check parameters.
+    if ((cas_params == NULL) || (old_value == NULL) || (swap_done == NULL) || (cas_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status.
+    (cas_status->all) = 0;
+    (cas_status->type) = UNA_ACCESS_TYPE_WRITE;
+    (*swap_done) = 0;
+    // Build compare and swap command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_COMPARE_AND_SWAP);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) (cas_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, expected_value);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, new_value);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Add mask if needed.
+    if (reg_mask != UNA_REGISTER_MASK_ALL) {
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, reg_mask);
+        if (status != UNA_AT_SUCCESS) goto errors;
+    }
+    // Add ending marker.
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // The old value is returned instead of the OK status.
+    reply_params.type = UNA_REPLY_TYPE_VALUE;
+    reply_params.timeout_ms = (cas_params->reply_params.timeout_ms);
+    // Perform access without retry since the swap may have been applied even if the reply is lost.
+    status = _UNA_AT_access_once((cas_params->node_addr), &reply_params, NULL, old_value, cas_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Check swap result.
+    if (((cas_status->flags) == 0) && ((((*old_value) ^ expected_value) & reg_mask) == 0)) {
+        (*swap_done) = 1;
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_CONDITIONAL_WAIT))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_wait_register(UNA_access_parameters_t* wait_params, uint32_t reg_mask, uint32_t expected_value, uint32_t wait_ms, uint32_t* reg_value, uint8_t* condition_met, UNA_access_status_t* wait_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    // Check parameters.
+    if ((wait_params == NULL) || (reg_value == NULL) || (condition_met == NULL) || (wait_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // The whole wait must fit in the reply sequence.
+    if ((wait_ms >= UNA_AT_SEQUENCE_TIMEOUT_MS) || ((wait_params->reply_params.timeout_ms) >= (UNA_AT_SEQUENCE_TIMEOUT_MS - wait_ms))) {
+        status = UNA_AT_ERROR_WAIT_DURATION;
+        goto errors;
+    }
+    // Reset access status and result.
+    (wait_status->all) = 0;
+    (wait_status->type) = UNA_ACCESS_TYPE_READ;
+    (*condition_met) = 0;
+    // Build conditional wait command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_CONDITIONAL_WAIT);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) (wait_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, reg_mask);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, expected_value);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, wait_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // The OK status is skipped and the value is sent by the node when the condition holds or when the wait expires.
+    reply_params.type = UNA_REPLY_TYPE_VALUE;
+    reply_params.timeout_ms = (wait_ms + (wait_params->reply_params.timeout_ms));
+    // Perform access without retry so that the blocking time is bounded by the wait duration.
+    status = _UNA_AT_access_once((wait_params->node_addr), &reply_params, NULL, reg_value, wait_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Check condition.
+    if (((wait_status->flags) == 0) && ((((*reg_value) ^ expected_value) & reg_mask) == 0)) {
+        (*condition_met) = 1;
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BATCH))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_execute_batch(UNA_AT_batch_operation_t* operation_list, uint8_t operation_count, uint32_t* batch_time_ms) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    UNA_AT_batch_operation_t* operation = NULL;
+    uint32_t start_tick_ms = 0;
+    uint32_t tick_ms = 0;
+    uint32_t reg_value = 0;
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    uint32_t baud_rate = 0;
+#endif
+#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
+    uint32_t retry_count = 0;
+#endif
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((operation_list == NULL) || (batch_time_ms == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*batch_time_ms) = 0;
+    // Reset all access status.
+    for (idx = 0; idx < operation_count; idx++) {
+        (operation_list[idx].access_status.all) = 0;
+        (operation_list[idx].access_status.type) = (operation_list[idx].type);
+    }
+    if (operation_count == 0) goto errors;
+    status = _UNA_AT_get_tick_ms(&start_tick_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Build first command.
+    status = _UNA_AT_build_batch_command(&(operation_list[0]));
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Operations loop.
+    for (idx = 0; idx < operation_count; idx++) {
+        operation = &(operation_list[idx]);
+#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
+        for (retry_count = 0; retry_count < UNA_AT_NODE_ACCESS_RETRY_MAX; retry_count++) {
+            // The next command has been built in place of the failed one.
+            if (retry_count > 0) {
+                status = _UNA_AT_build_batch_command(operation);
+                if (status != UNA_AT_SUCCESS) goto errors;
+            }
+#endif
+            // Send current command.
+            status = _UNA_AT_send(operation->access_params.node_addr);
+            if (status != UNA_AT_SUCCESS) goto errors;
+            // Build the next command during the node turnaround time.
+            if ((idx + 1) < operation_count) {
+                status = _UNA_AT_build_batch_command(&(operation_list[idx + 1]));
+                if (status != UNA_AT_SUCCESS) goto errors;
+            }
+            // Wait current reply (directly returns for none reply type, so that the next command is sent back to back).
+            status = _UNA_AT_wait_reply(&(operation->access_params.reply_params), NULL, &reg_value, &(operation->access_status));
+            if (status != UNA_AT_SUCCESS) goto errors;
+#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
+            // Exit on first success.
+            if ((operation->access_status.flags) == 0) break;
+        }
+#endif
+        if (((operation->type) == UNA_ACCESS_TYPE_READ) && ((operation->access_status.flags) == 0)) {
+            (operation->reg_value) = reg_value;
+        }
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+        baud_rate = una_at_ctx.baud_rate;
+        status = _UNA_AT_check_baud_rate(&(operation->access_status));
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // The fallback procedure overwrites the next command.
+        if ((una_at_ctx.baud_rate != baud_rate) && ((idx + 1) < operation_count)) {
+            status = _UNA_AT_build_batch_command(&(operation_list[idx + 1]));
+            if (status != UNA_AT_SUCCESS) goto errors;
+        }
+#endif
+    }
+    // Compute batch duration.
+    status = _UNA_AT_get_tick_ms(&tick_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    (*batch_time_ms) = (tick_ms - start_tick_ms);
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_negotiate_baud_rate(UNA_node_t* node_list, uint8_t node_count, uint32_t baud_rate_max, uint32_t* baud_rate) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    UNA_access_parameters_t read_params;
+    UNA_access_status_t read_status;
+    uint32_t reg_value = 0;
+    uint32_t node_baud_rate = 0;
+    uint32_t common_baud_rate = baud_rate_max;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((node_list == NULL) || (baud_rate == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // The procedure handles its own errors.
+    una_at_ctx.baud_rate_monitor_flag = 0;
+    // Build read input common parameters.
+    read_params.reg_addr = UNA_AT_BAUD_RATE_REGISTER_ADDRESS;
+    read_params.reply_params.timeout_ms = UNA_AT_SCAN_REGISTER_TIMEOUT_MS;
+    read_params.reply_params.type = UNA_REPLY_TYPE_VALUE;
+    // Compute the highest baud rate supported by all nodes.
+    for (idx = 0; idx < node_count; idx++) {
+        read_params.node_addr = node_list[idx].address;
+        status = UNA_AT_read_register(&read_params, &reg_value, &read_status);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Nodes without capability register are limited to the default baud rate.
+        node_baud_rate = una_at_ctx.baud_rate_default;
+        if (read_status.flags == 0) {
+            node_baud_rate = (SWREG_read_field(reg_value, UNA_AT_BAUD_RATE_REGISTER_MASK) * UNA_AT_BAUD_RATE_REGISTER_UNIT);
+        }
+        if (node_baud_rate < common_baud_rate) {
+            common_baud_rate = node_baud_rate;
+        }
+    }
+    // The default baud rate is always supported.
+    if (common_baud_rate < una_at_ctx.baud_rate_default) {
+        common_baud_rate = una_at_ctx.baud_rate_default;
+    }
+    // Switch the whole bus if needed.
+    if (common_baud_rate != una_at_ctx.baud_rate) {
+        status = _UNA_AT_switch_baud_rate(common_baud_rate);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Check that all nodes are still reachable.
+        for (idx = 0; idx < node_count; idx++) {
+            read_params.node_addr = node_list[idx].address;
+            status = UNA_AT_read_register(&read_params, &reg_value, &read_status);
+            if (status != UNA_AT_SUCCESS) goto errors;
+            if (read_status.flags != 0) break;
+        }
+        // Go back to the default baud rate on failure.
+        if ((idx < node_count) && (una_at_ctx.baud_rate != una_at_ctx.baud_rate_default)) {
+            status = _UNA_AT_switch_baud_rate(una_at_ctx.baud_rate_default);
+            if (status != UNA_AT_SUCCESS) goto errors;
+        }
+    }
+    (*baud_rate) = una_at_ctx.baud_rate;
+errors:
+    una_at_ctx.baud_rate_monitor_flag = 1;
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BROADCAST_NODE_ADDRESS))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_broadcast_write_register(uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    // Build write command.
+    status = _UNA_AT_build_write_command(UNA_AT_COMMAND_WRITE_REGISTER, reg_addr, reg_value, reg_mask);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Send single frame to all nodes without waiting any reply.
+    status = _UNA_AT_send(UNA_AT_BROADCAST_NODE_ADDRESS);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BROADCAST_NODE_ADDRESS))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_broadcast_verify_register(UNA_node_t* node_list, uint8_t node_count, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask, uint32_t timeout_ms, uint8_t* failed_count) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    UNA_access_parameters_t access_params;
+    UNA_access_status_t access_status;
+    uint32_t read_value = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((node_list == NULL) || (failed_count == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset count.
+    (*failed_count) = 0;
+    // Build access common parameters.
+    access_params.reg_addr = reg_addr;
+    access_params.reply_params.timeout_ms = timeout_ms;
+    // Nodes loop.
+    for (idx = 0; idx < node_count; idx++) {
+        access_params.node_addr = node_list[idx].address;
+        // Read back register.
+        access_params.reply_params.type = UNA_REPLY_TYPE_VALUE;
+        status = UNA_AT_read_register(&access_params, &read_value, &access_status);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Skip nodes which have applied the broadcast value.
+        if ((access_status.flags == 0) && (((read_value ^ reg_value) & reg_mask) == 0)) continue;
+        // Fall back to unicast write on the other nodes.
+        access_params.reply_params.type = UNA_REPLY_TYPE_OK;
+        status = UNA_AT_write_register(&access_params, reg_value, reg_mask, &access_status);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Update count.
+        if (access_status.flags != 0) {
+            (*failed_count)++;
+        }
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_write_block(UNA_access_parameters_t* write_params, uint32_t offset, uint8_t* data, uint32_t data_size_bytes, uint8_t chunk_size_bytes, UNA_access_status_t* write_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    uint32_t unused_reg_value = 0;
+    uint32_t chunk_offset = 0;
+    uint32_t chunk_length = 0;
+    // Check parameters.
+    if ((write_params == NULL) || (data == NULL) || (write_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((chunk_size_bytes == 0) || (chunk_size_bytes > UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES)) {
+        status = UNA_AT_ERROR_CHUNK_SIZE;
+        goto errors;
+    }
+    // Reset access status.
+    (write_status->all) = 0;
+    (write_status->type) = UNA_ACCESS_TYPE_WRITE;
+    // Chunks loop.
+    for (chunk_offset = 0; chunk_offset < data_size_bytes; chunk_offset += chunk_size_bytes) {
+        // Compute chunk length.
+        chunk_length = (data_size_bytes - chunk_offset);
+        if (chunk_length > chunk_size_bytes) {
+            chunk_length = chunk_size_bytes;
+        }
+        // Build write block command.
+        terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_WRITE_BLOCK);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) (write_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, offset + chunk_offset);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        terminal_status = TERMINAL_tx_buffer_add_byte_array(UNA_AT_MASTER_TERMINAL_INSTANCE, &(data[chunk_offset]), chunk_length, 0);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        status = _UNA_AT_tx_buffer_add_register(UNA_AT_MASTER_TERMINAL_INSTANCE, (uint32_t) _UNA_AT_compute_crc(&(data[chunk_offset]), chunk_length));
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Add ending marker.
+        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+        // Perform access (the chunk is retransmitted alone on failure).
+        status = _UNA_AT_access((write_params->node_addr), &(write_params->reply_params), NULL, &unused_reg_value, write_status);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Stop on first failed chunk.
+        if ((write_status->flags) != 0) break;
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_read_block(UNA_access_parameters_t* read_params, uint32_t offset, uint8_t* data, uint32_t data_size_bytes, uint8_t chunk_size_bytes, UNA_access_status_t* read_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    uint32_t window_offset = 0;
+    uint32_t window_size = 0;
+    uint32_t window_bitmap = 0;
+    uint32_t chunk_length = 0;
+    uint8_t chunk_count = 0;
+    uint8_t chunk_idx = 0;
+    uint8_t pass_idx = 0;
+    // Check parameters.
+    if ((read_params == NULL) || (data == NULL) || (read_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((chunk_size_bytes == 0) || (chunk_size_bytes > UNA_AT_BLOCK_CHUNK_SIZE_MAX_BYTES)) {
+        status = UNA_AT_ERROR_CHUNK_SIZE;
+        goto errors;
+    }
+    // Reset access status.
+    (read_status->all) = 0;
+    (read_status->type) = UNA_ACCESS_TYPE_READ;
+    // Windows loop.
+    for (window_offset = 0; window_offset < data_size_bytes; window_offset += window_size) {
+        // Compute window size.
+        window_size = (data_size_bytes - window_offset);
+        if (window_size > (chunk_size_bytes * UNA_AT_BLOCK_WINDOW_SIZE)) {
+            window_size = (chunk_size_bytes * UNA_AT_BLOCK_WINDOW_SIZE);
+        }
+        chunk_count = (uint8_t) ((window_size + chunk_size_bytes - 1) / chunk_size_bytes);
+        window_bitmap = (chunk_count >= 32) ? 0xFFFFFFFF : ((((uint32_t) 0b1) << chunk_count) - 1);
+        // Init block context.
+        una_at_ctx.block.data = &(data[window_offset]);
+        una_at_ctx.block.offset = (offset + window_offset);
+        una_at_ctx.block.size = window_size;
+        una_at_ctx.block.chunk_size = chunk_size_bytes;
+        una_at_ctx.block.chunk_bitmap = 0;
+        // Stream the whole window at once.
+        status = _UNA_AT_read_block_request(read_params, una_at_ctx.block.offset, window_size, read_status);
+        if (status != UNA_AT_SUCCESS) goto errors;
+        // Selectively request the missing or corrupted chunks.
+        for (pass_idx = 0; pass_idx < UNA_AT_NODE_ACCESS_RETRY_MAX; pass_idx++) {
+            // Exit as soon as the window is complete.
+            if (una_at_ctx.block.chunk_bitmap == window_bitmap) break;
+            for (chunk_idx = 0; chunk_idx < chunk_count; chunk_idx++) {
+                // Skip already received chunks.
+                if ((una_at_ctx.block.chunk_bitmap & (((uint32_t) 0b1) << chunk_idx)) != 0) continue;
+                // Compute chunk length.
+                chunk_length = (window_size - (chunk_idx * chunk_size_bytes));
+                if (chunk_length > chunk_size_bytes) {
+                    chunk_length = chunk_size_bytes;
+                }
+                status = _UNA_AT_read_block_request(read_params, (una_at_ctx.block.offset + (chunk_idx * chunk_size_bytes)), chunk_length, read_status);
+                if (status != UNA_AT_SUCCESS) goto errors;
+            }
+        }
+        // Check window completion.
+        if (una_at_ctx.block.chunk_bitmap != window_bitmap) {
+            // Keep the last access status if any, otherwise report a parser error.
+            if ((read_status->flags) == 0) {
+                (read_status->parser_error) = 1;
+            }
+            break;
+        }
+        (read_status->flags) = 0;
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_NOTIFICATIONS))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_poll_notifications(UNA_node_address_t node_addr, uint32_t timeout_ms, uint8_t* notification_count, UNA_access_status_t* poll_status) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    UNA_reply_parameters_t reply_params;
+    uint32_t unused_reg_value = 0;
+    // Check parameters.
+    if ((notification_count == NULL) || (poll_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status and count.
+    (poll_status->all) = 0;
+    (poll_status->type) = UNA_ACCESS_TYPE_READ;
+    una_at_ctx.received_notification_count = 0;
+    // Build poll command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_NOTIFICATIONS);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Notifications lines are decoded by the reception loop until the OK status.
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = timeout_ms;
+    una_at_ctx.reply_drain_flag = 1;
+    status = _UNA_AT_access(node_addr, &reply_params, NULL, &unused_reg_value, poll_status);
+    una_at_ctx.reply_drain_flag = 0;
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Notifications are kept by the node until the complete list has been received.
+    if ((poll_status->flags) != 0) goto errors;
+    // Acknowledge notifications.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_NOTIFICATION_ACK);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_access(node_addr, &reply_params, NULL, &unused_reg_value, poll_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+errors:
+    if (notification_count != NULL) {
+        (*notification_count) = una_at_ctx.received_notification_count;
+    }
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_DIRTY_REGISTERS))
 /*******************************************************************/
-UNA_AT_status_t UNA_AT_init(UNA_AT_configuration_t* configuration) {
+UNA_AT_status_t UNA_AT_read_dirty_registers(UNA_node_address_t node_addr, uint32_t timeout_ms, uint32_t* reg_mirror, uint16_t reg_mirror_size, uint16_t* update_count, UNA_access_status_t* read_status) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
-#ifdef UNA_AT_MODE_MASTER
     TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
-#endif
-#ifdef UNA_AT_MODE_SLAVE
-    AT_status_t at_status = AT_SUCCESS;
-    AT_configuration_t at_config;
-    uint8_t idx = 0;
-#endif
-    // Check parameter.
-    if (configuration == NULL) {
+    UNA_reply_parameters_t reply_params;
+    uint32_t unused_reg_value = 0;
+    // Check parameters.
+    if ((reg_mirror == NULL) || (update_count == NULL) || (read_status == NULL)) {
         status = UNA_AT_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Init context.
-#ifdef UNA_AT_MODE_MASTER
-    _UNA_AT_flush_replies();
-#endif
-#ifdef UNA_AT_MODE_SLAVE
-    una_at_ctx.at_process_flag = 0;
-    una_at_ctx.process_callback = (configuration->process_callback);
-    una_at_ctx.write_register_callback = (configuration->write_register_callback);
-    una_at_ctx.read_register_callback = (configuration->read_register_callback);
-#endif
-    // Init low level interface.
-#ifdef UNA_AT_MODE_MASTER
-    // Init bus terminal.
-    terminal_status = TERMINAL_open(UNA_AT_TERMINAL_INSTANCE, (configuration->baud_rate), &_UNA_AT_rx_irq_callback);
+    // Reset access status and count.
+    (read_status->all) = 0;
+    (read_status->type) = UNA_ACCESS_TYPE_READ;
+    una_at_ctx.dirty_mirror = reg_mirror;
+    una_at_ctx.dirty_mirror_size = reg_mirror_size;
+    una_at_ctx.dirty_count = 0;
+    // Build command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-#endif
-#ifdef UNA_AT_MODE_SLAVE
-    // Init AT receiver.
-    at_config.process_callback = &_UNA_AT_at_process_callback;
-    at_config.terminal_instance = UNA_AT_TERMINAL_INSTANCE;
-    at_status = AT_init(&at_config, &(una_at_ctx.at_parser_ptr));
-    AT_exit_error(UNA_AT_ERROR_BASE_AT);
-    // Register commands.
-    for (idx = 0; idx < (sizeof(UNA_AT_COMMANDS_LIST) / sizeof(AT_command_t)); idx++) {
-        at_status = AT_register_command(&(UNA_AT_COMMANDS_LIST[idx]));
-        AT_exit_error(UNA_AT_ERROR_BASE_AT);
-    }
-#ifdef UNA_AT_CUSTOM_COMMANDS
-    *(configuration->parser_context_ptr) = una_at_ctx.at_parser_ptr;
-#endif
-#endif
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_DIRTY_REGISTERS);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Registers lines are decoded on the fly until the OK status.
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = timeout_ms;
+    status = _UNA_AT_access(node_addr, &reply_params, &_UNA_AT_read_dirty_registers_line_callback, &unused_reg_value, read_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Registers are kept dirty by the node until the complete list has been received.
+    if ((read_status->flags) != 0) goto errors;
+    // Acknowledge synchronization.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_DIRTY_ACK);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    status = _UNA_AT_access(node_addr, &reply_params, NULL, &unused_reg_value, read_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
 errors:
+    if (update_count != NULL) {
+        (*update_count) = una_at_ctx.dirty_count;
+    }
     return status;
 }
+#endif
 
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_SNAPSHOT))
 /*******************************************************************/
-UNA_AT_status_t UNA_AT_de_init(void) {
+UNA_AT_status_t UNA_AT_read_snapshot(UNA_access_parameters_t* read_params, uint8_t reg_count, uint32_t* reg_values, UNA_access_status_t* read_status) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
-#ifdef UNA_AT_MODE_MASTER
     TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
-#endif
-#ifdef UNA_AT_MODE_SLAVE
-    AT_status_t at_status = AT_SUCCESS;
-    uint8_t idx = 0;
-#endif
-    // Release low level interface.
-#ifdef UNA_AT_MODE_MASTER
-    // Release bus terminal.
-    terminal_status = TERMINAL_close(UNA_AT_TERMINAL_INSTANCE);
+    UNA_reply_parameters_t reply_params;
+    uint32_t unused_reg_value = 0;
+    // Check parameters.
+    if ((read_params == NULL) || (reg_values == NULL) || (read_status == NULL)) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status and count.
+    (read_status->all) = 0;
+    (read_status->type) = UNA_ACCESS_TYPE_READ;
+    una_at_ctx.snapshot_values = reg_values;
+    una_at_ctx.snapshot_reg_addr = (read_params->reg_addr);
+    una_at_ctx.snapshot_size = reg_count;
+    una_at_ctx.snapshot_count = 0;
+    // Build latch command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-#endif
-#ifdef UNA_AT_MODE_SLAVE
-    // Unregister commands.
-    for (idx = 0; idx < (sizeof(UNA_AT_COMMANDS_LIST) / sizeof(AT_command_t)); idx++) {
-        AT_unregister_command(&(UNA_AT_COMMANDS_LIST[idx]));
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_LATCH);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) (read_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_MASTER_TERMINAL_INSTANCE, (int32_t) reg_count, STRING_FORMAT_HEXADECIMAL, 0);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
+    // Registers lines are decoded on the fly until the OK status.
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = (read_params->reply_params.timeout_ms);
+    status = _UNA_AT_access((read_params->node_addr), &reply_params, &_UNA_AT_read_snapshot_line_callback, &unused_reg_value, read_status);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Report incomplete range.
+    if (((read_status->flags) == 0) && (una_at_ctx.snapshot_count != reg_count)) {
+        (read_status->parser_error) = 1;
     }
-    // Init AT receiver.
-    at_status = AT_de_init();
-    AT_exit_error(UNA_AT_ERROR_BASE_AT);
-#endif
 errors:
     return status;
 }
+#endif
 
-#ifdef UNA_AT_MODE_MASTER
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_SNAPSHOT))
 /*******************************************************************/
-UNA_AT_status_t UNA_AT_send_command(UNA_command_parameters_t* command_params) {
+UNA_AT_status_t UNA_AT_release_snapshot(UNA_node_address_t node_addr, uint32_t timeout_ms, UNA_access_status_t* release_status) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
     TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
-    // Add command.
-    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_TERMINAL_INSTANCE);
+    UNA_reply_parameters_t reply_params;
+    uint32_t unused_reg_value = 0;
+    // Check parameters.
+    if (release_status == NULL) {
+        status = UNA_AT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset access status.
+    (release_status->all) = 0;
+    (release_status->type) = UNA_ACCESS_TYPE_WRITE;
+    // Build release command.
+    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_MASTER_TERMINAL_INSTANCE);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, (command_params->command));
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_RELEASE);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    // Add ending marker.
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
+    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_MASTER_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
     TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    // Send command.
-    status = _UNA_AT_send(command_params->node_addr);
+    // Perform access.
+    reply_params.type = UNA_REPLY_TYPE_OK;
+    reply_params.timeout_ms = timeout_ms;
+    status = _UNA_AT_access(node_addr, &reply_params, NULL, &unused_reg_value, release_status);
     if (status != UNA_AT_SUCCESS) goto errors;
 errors:
     return status;
 }
 #endif
 
-#ifdef UNA_AT_MODE_MASTER
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
 /*******************************************************************/
-UNA_AT_status_t UNA_AT_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status) {
+UNA_AT_status_t UNA_AT_polling_start(UNA_AT_polling_entry_t* polling_table, uint8_t polling_table_size, UNA_AT_polling_cb_t polling_callback) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
-    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
-    uint32_t unused_reg_value = 0;
-#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
-    uint32_t retry_count = 0;
-#endif
+    uint32_t tick_ms = 0;
+    uint8_t idx = 0;
     // Check parameters.
-    if ((write_params == NULL) || (write_status == NULL)) {
+    if (polling_table == NULL) {
         status = UNA_AT_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Reset access status.
-    (write_status->all) = 0;
-    (write_status->type) = UNA_ACCESS_TYPE_WRITE;
-    // Build write command.
-    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_TERMINAL_INSTANCE);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_WRITE_REGISTER);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_TERMINAL_INSTANCE, (int32_t) (write_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    status = _UNA_AT_tx_buffer_add_register(reg_value);
+    status = _UNA_AT_get_tick_ms(&tick_ms);
     if (status != UNA_AT_SUCCESS) goto errors;
-    // Add mask if needed.
-    if (reg_mask != UNA_REGISTER_MASK_ALL) {
-        terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_SEPARATOR);
-        TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-        status = _UNA_AT_tx_buffer_add_register(reg_mask);
-        if (status != UNA_AT_SUCCESS) goto errors;
-    }
-    // Add ending marker.
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
-    for (retry_count = 0; retry_count < UNA_AT_NODE_ACCESS_RETRY_MAX; retry_count++) {
-#endif
-        // Send command.
-        status = _UNA_AT_send(write_params->node_addr);
-        if (status != UNA_AT_SUCCESS) goto errors;
-        // Wait reply.
-        status = _UNA_AT_wait_reply(&(write_params->reply_params), &unused_reg_value, write_status);
-        if (status != UNA_AT_SUCCESS) goto errors;
-#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
-        // Exit on first success.
-        if (write_status->flags == 0) break;
+    // Release all entries immediately.
+    for (idx = 0; idx < polling_table_size; idx++) {
+        polling_table[idx].release_ms = tick_ms;
+        polling_table[idx].deadline_miss_count = 0;
+        polling_table[idx].access_status.all = 0;
     }
-#endif
+    // Update context.
+    una_at_ctx.polling_table = polling_table;
+    una_at_ctx.polling_table_size = polling_table_size;
+    una_at_ctx.polling_callback = polling_callback;
 errors:
     return status;
 }
 #endif
 
-#ifdef UNA_AT_MODE_MASTER
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
 /*******************************************************************/
-UNA_AT_status_t UNA_AT_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status) {
+UNA_AT_status_t UNA_AT_polling_stop(void) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
-    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
-#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
-    uint32_t retry_count = 0;
+    // Reset context.
+    una_at_ctx.polling_table = NULL;
+    una_at_ctx.polling_table_size = 0;
+    una_at_ctx.polling_callback = NULL;
+    return status;
+}
 #endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_POLLING))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_polling_process(uint32_t* idle_time_ms) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    UNA_AT_polling_entry_t* entry = NULL;
+    UNA_access_parameters_t read_params;
+    uint32_t tick_ms = 0;
+    uint32_t deadline_ms = 0;
+    uint32_t entry_deadline_ms = 0;
+    uint32_t release_delay_ms = 0;
+    uint8_t idx = 0;
     // Check parameters.
-    if ((read_params == NULL) || (read_status == NULL) || (reg_value == NULL)) {
+    if ((idle_time_ms == NULL) || (una_at_ctx.polling_table == NULL)) {
         status = UNA_AT_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Reset access status.
-    (read_status->all) = 0;
-    (read_status->type) = UNA_ACCESS_TYPE_READ;
-    // Build read command.
-    terminal_status = TERMINAL_flush_tx_buffer(UNA_AT_TERMINAL_INSTANCE);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_READ_REGISTER);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    terminal_status = TERMINAL_tx_buffer_add_integer(UNA_AT_TERMINAL_INSTANCE, (uint32_t) (read_params->reg_addr), STRING_FORMAT_HEXADECIMAL, 0);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-    // Add ending marker.
-    terminal_status = TERMINAL_tx_buffer_add_string(UNA_AT_TERMINAL_INSTANCE, UNA_AT_COMMAND_END);
-    TERMINAL_exit_error(UNA_AT_ERROR_BASE_TERMINAL);
-#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
-    for (retry_count = 0; retry_count < UNA_AT_NODE_ACCESS_RETRY_MAX; retry_count++) {
-#endif
-        // Send command.
-        status = _UNA_AT_send(read_params->node_addr);
+    status = _UNA_AT_get_tick_ms(&tick_ms);
+    if (status != UNA_AT_SUCCESS) goto errors;
+    // Select the released entry with the earliest deadline, the highest priority wins on tie.
+    for (idx = 0; idx < una_at_ctx.polling_table_size; idx++) {
+        // Skip entries which are not released yet.
+        if (((int32_t) (tick_ms - una_at_ctx.polling_table[idx].release_ms)) < 0) continue;
+        entry_deadline_ms = (una_at_ctx.polling_table[idx].release_ms + una_at_ctx.polling_table[idx].period_ms);
+        if ((entry == NULL) || (((int32_t) (entry_deadline_ms - deadline_ms)) < 0) || ((entry_deadline_ms == deadline_ms) && (una_at_ctx.polling_table[idx].priority > (entry->priority)))) {
+            entry = &(una_at_ctx.polling_table[idx]);
+            deadline_ms = entry_deadline_ms;
+        }
+    }
+    // Perform access.
+    if (entry != NULL) {
+        read_params.node_addr = (entry->node_addr);
+        read_params.reg_addr = (entry->reg_addr);
+        read_params.reply_params.type = UNA_REPLY_TYPE_VALUE;
+        read_params.reply_params.timeout_ms = (entry->timeout_ms);
+        status = UNA_AT_read_register(&read_params, &(entry->reg_value), &(entry->access_status));
         if (status != UNA_AT_SUCCESS) goto errors;
-        // Wait reply.
-        status = _UNA_AT_wait_reply(&(read_params->reply_params), reg_value, read_status);
+        status = _UNA_AT_get_tick_ms(&tick_ms);
         if (status != UNA_AT_SUCCESS) goto errors;
-#if (UNA_AT_NODE_ACCESS_RETRY_MAX > 1)
-        // Exit on first success.
-        if (read_status->flags == 0) break;
+        // Check deadline.
+        if (UNA_AT_DEADLINE_REACHED(tick_ms, deadline_ms)) {
+            (entry->deadline_miss_count)++;
+        }
+        // Compute next release, without trying to catch up the missed periods.
+        (entry->release_ms) += (entry->period_ms);
+        if (((int32_t) (tick_ms - (entry->release_ms))) > 0) {
+            (entry->release_ms) = tick_ms;
+        }
+        // Put all the entries of a non responding node on hold.
+        if ((entry->access_status.flags) != 0) {
+            for (idx = 0; idx < una_at_ctx.polling_table_size; idx++) {
+                if (una_at_ctx.polling_table[idx].node_addr == (entry->node_addr)) {
+                    una_at_ctx.polling_table[idx].release_ms = (tick_ms + UNA_AT_POLLING_NODE_BACKOFF_MS);
+                }
+            }
+        }
+        // Deliver result.
+        if (una_at_ctx.polling_callback != NULL) {
+            una_at_ctx.polling_callback(entry);
+        }
+    }
+    // Compute time before next release.
+    (*idle_time_ms) = 0xFFFFFFFF;
+    for (idx = 0; idx < una_at_ctx.polling_table_size; idx++) {
+        release_delay_ms = (una_at_ctx.polling_table[idx].release_ms - tick_ms);
+        if (((int32_t) release_delay_ms) <= 0) {
+            (*idle_time_ms) = 0;
+            break;
+        }
+        if (release_delay_ms < (*idle_time_ms)) {
+            (*idle_time_ms) = release_delay_ms;
+        }
+    }
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_DIRTY_REGISTERS))
+/*******************************************************************/
+void UNA_AT_set_dirty_register(uint8_t reg_addr) {
+    // Check address.
+    if (reg_addr >= UNA_AT_DIRTY_REGISTERS_NUMBER) return;
+    // Set flag (single byte write, safe from interrupt context).
+    una_at_ctx.dirty_flag[reg_addr] = 1;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+void UNA_AT_set_irq_read_register(uint8_t reg_addr, uint32_t reg_value) {
+    // Check address.
+    if (reg_addr >= UNA_AT_IRQ_READ_REGISTERS_NUMBER) return;
+    // Single word accesses: the value is updated before being published to the reception context.
+    una_at_ctx.irq_read_value[reg_addr] = reg_value;
+    una_at_ctx.irq_read_bitmap[reg_addr / 32] |= (((uint32_t) 0b1) << (reg_addr % 32));
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+void UNA_AT_irq_read_rx_callback(uint8_t data) {
+    // Copy the line, the AT driver buffer is not accessible from the reception context.
+    if ((data != STRING_CHAR_CR) && (data != STRING_CHAR_LF)) {
+        if (una_at_ctx.irq_read_line_size < UNA_AT_IRQ_READ_LINE_SIZE_BYTES) {
+            una_at_ctx.irq_read_line[una_at_ctx.irq_read_line_size] = data;
+        }
+        // Longer lines are kept marked as too long until the ending marker.
+        if (una_at_ctx.irq_read_line_size <= UNA_AT_IRQ_READ_LINE_SIZE_BYTES) {
+            una_at_ctx.irq_read_line_size++;
+        }
+        goto errors;
     }
+    // Answer IRQ-safe registers reads directly from the reception context, unless a command is being processed.
+    if ((una_at_ctx.irq_read_line_size != 0) && (una_at_ctx.at_busy_flag == 0) && (una_at_ctx.at_process_flag == 0)) {
+        una_at_ctx.irq_read_done_flag = 0;
+        _UNA_AT_irq_read_register();
+    }
+    una_at_ctx.irq_read_line_size = 0;
+errors:
+    return;
+}
 #endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+/*******************************************************************/
+UNA_AT_status_t UNA_AT_notify(uint8_t reg_addr, uint32_t reg_value) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_SUCCESS;
+    uint8_t write_idx = una_at_ctx.notification_write_idx;
+    uint8_t next_write_idx = (uint8_t) ((write_idx + 1) % UNA_AT_NOTIFICATION_QUEUE_SIZE);
+    // Check queue.
+    if (next_write_idx == una_at_ctx.notification_read_idx) {
+        status = UNA_AT_ERROR_NOTIFICATION_QUEUE_FULL;
+        goto errors;
+    }
+    // Fill the free slot before publishing it to the command processing.
+    una_at_ctx.notification_queue[write_idx].reg_addr = reg_addr;
+    una_at_ctx.notification_queue[write_idx].reg_value = reg_value;
+    una_at_ctx.notification_write_idx = next_write_idx;
 errors:
     return status;
 }
@@ -641,6 +3224,10 @@ UNA_AT_status_t UNA_AT_scan(UNA_node_t* node_list, uint8_t node_list_size, uint8
     }
     // Reset count.
     (*node_count) = 0;
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    // Absent nodes must not trigger the baud rate fallback.
+    una_at_ctx.baud_rate_monitor_flag = 0;
+#endif
     // Build read input common parameters.
     read_params.reg_addr = UNA_AT_SCAN_REGISTER_ADDRESS;
     read_params.reply_params.timeout_ms = UNA_AT_SCAN_REGISTER_TIMEOUT_MS;
@@ -667,6 +3254,9 @@ UNA_AT_status_t UNA_AT_scan(UNA_node_t* node_list, uint8_t node_list_size, uint8
         if ((*node_count) >= node_list_size) break;
     }
 errors:
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    una_at_ctx.baud_rate_monitor_flag = 1;
+#endif
     return status;
 }
 #endif
@@ -677,15 +3267,98 @@ UNA_AT_status_t UNA_AT_process(void) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
     AT_status_t at_status = AT_SUCCESS;
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_GATEWAY_FORWARDING))
+    UNA_node_address_t destination_address = 0;
+#endif
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_IRQ_READ))
+    uint8_t reply_mute_flag = 0;
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    uint8_t command_known_flag = 0;
+#endif
     // Check AT flag.
     if (una_at_ctx.at_process_flag != 0) {
+#ifdef UNA_AT_IRQ_READ
+        // Prevent the reception context from replying until the command is processed.
+        una_at_ctx.at_busy_flag = 1;
+#endif
         // Clear flag.
         una_at_ctx.at_process_flag = 0;
+#ifdef UNA_AT_CONDITIONAL_WAIT
+        // Any new command means that the master does not wait for the previous condition anymore.
+        una_at_ctx.wait_flag = 0;
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+        // Check the line before the parser consumes it.
+        command_known_flag = _UNA_AT_is_command_known();
+#endif
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_GATEWAY_FORWARDING))
+        status = UNA_AT_HW_get_destination_address(&destination_address);
+        if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+#ifdef UNA_AT_BROADCAST_NODE_ADDRESS
+        // Nodes must not reply to broadcast commands, including the status sent by the AT driver.
+        if (destination_address == UNA_AT_BROADCAST_NODE_ADDRESS) {
+            reply_mute_flag = 1;
+        }
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+        // Commands addressed to another node are forwarded on the downstream bus, broadcast commands are executed locally.
+        una_at_ctx.forward_node_addr = destination_address;
+        una_at_ctx.forward_flag = (destination_address != una_at_ctx.gateway_node_addr) ? 1 : 0;
+#ifdef UNA_AT_BROADCAST_NODE_ADDRESS
+        if (destination_address == UNA_AT_BROADCAST_NODE_ADDRESS) {
+            una_at_ctx.forward_flag = 0;
+        }
+#endif
+#endif
+#ifdef UNA_AT_IRQ_READ
+        // The complete reply, including the status, has already been sent from the reception context.
+        if (una_at_ctx.irq_read_done_flag != 0) {
+            reply_mute_flag = 1;
+        }
+#endif
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_IRQ_READ))
+        if (reply_mute_flag != 0) {
+            status = UNA_AT_HW_set_reply_mute(1);
+            if (status != UNA_AT_SUCCESS) goto errors;
+        }
+#endif
         // Process AT parser.
         at_status = AT_process();
+#if ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_IRQ_READ))
+        if (reply_mute_flag != 0) {
+            status = UNA_AT_HW_set_reply_mute(0);
+            if (status != UNA_AT_SUCCESS) goto errors;
+        }
+#endif
+#ifdef UNA_AT_IRQ_READ
+        una_at_ctx.irq_read_done_flag = 0;
+#endif
+#ifdef UNA_AT_GATEWAY_FORWARDING
+        una_at_ctx.forward_flag = 0;
+#endif
         AT_exit_error(UNA_AT_ERROR_BASE_AT);
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+        // Only a valid command proves that the master uses the current baud rate.
+        if (command_known_flag != 0) {
+            status = _UNA_AT_get_tick_ms(&(una_at_ctx.at_command_tick_ms));
+            if (status != UNA_AT_SUCCESS) goto errors;
+        }
+#endif
     }
+#ifdef UNA_AT_CONDITIONAL_WAIT
+    status = _UNA_AT_process_conditional_wait();
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    status = _UNA_AT_update_baud_rate();
+    if (status != UNA_AT_SUCCESS) goto errors;
+#endif
 errors:
+#ifdef UNA_AT_IRQ_READ
+    una_at_ctx.at_busy_flag = 0;
+#endif
     return status;
 }
 #endif
@@ -696,9 +3369,23 @@ UNA_AT_status_t UNA_AT_register_command(const AT_command_t* command) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
     AT_status_t at_status = AT_SUCCESS;
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    uint8_t idx = 0;
+    // Custom commands are also valid commands for the silence timeout.
+    for (idx = 0; idx < UNA_AT_CUSTOM_COMMANDS_NUMBER; idx++) {
+        if (una_at_ctx.custom_command[idx] == NULL) break;
+    }
+    if (idx >= UNA_AT_CUSTOM_COMMANDS_NUMBER) {
+        status = UNA_AT_ERROR_CUSTOM_COMMANDS_FULL;
+        goto errors;
+    }
+#endif
     // Register command.
     at_status = AT_register_command(command);
     AT_exit_error(UNA_AT_ERROR_BASE_AT);
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    una_at_ctx.custom_command[idx] = command;
+#endif
 errors:
     return status;
 }
@@ -710,9 +3397,19 @@ UNA_AT_status_t UNA_AT_unregister_command(const AT_command_t* command) {
     // Local variables.
     UNA_AT_status_t status = UNA_AT_SUCCESS;
     AT_status_t at_status = AT_SUCCESS;
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    uint8_t idx = 0;
+#endif
     // Unregister command.
     at_status = AT_unregister_command(command);
     AT_exit_error(UNA_AT_ERROR_BASE_AT);
+#ifdef UNA_AT_BAUD_RATE_NEGOTIATION
+    for (idx = 0; idx < UNA_AT_CUSTOM_COMMANDS_NUMBER; idx++) {
+        if (una_at_ctx.custom_command[idx] == command) {
+            una_at_ctx.custom_command[idx] = NULL;
+        }
+    }
+#endif
 errors:
     return status;
 }
@@ -751,5 +3448,38 @@ void UNA_AT_send_reply(void) {
 #if (!(defined UNA_AT_MODE_MASTER) && !(defined UNA_AT_MODE_SLAVE))
 #error "una-at: None mode selected"
 #endif
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_MODE_SLAVE))
+#ifndef UNA_AT_GATEWAY_TERMINAL_INSTANCE
+#error "una-at: UNA_AT_GATEWAY_TERMINAL_INSTANCE must be defined when both modes are selected"
+#elif (UNA_AT_GATEWAY_TERMINAL_INSTANCE == UNA_AT_TERMINAL_INSTANCE)
+#error "una-at: upstream and downstream buses must use different terminal instances"
+#endif
+#endif
+#if ((defined UNA_AT_GATEWAY) && !((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_MODE_SLAVE)))
+#error "una-at: UNA_AT_GATEWAY requires both master and slave modes"
+#endif
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BAUD_RATE_NEGOTIATION) && !(defined UNA_AT_BROADCAST_NODE_ADDRESS))
+#error "una-at: UNA_AT_BAUD_RATE_NEGOTIATION requires UNA_AT_BROADCAST_NODE_ADDRESS in master mode"
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_SNAPSHOT))
+#if ((UNA_AT_SNAPSHOT_REGISTERS_NUMBER == 0) || (UNA_AT_SNAPSHOT_REGISTERS_NUMBER > 255))
+#error "una-at: UNA_AT_SNAPSHOT_REGISTERS_NUMBER must be in the range 1 to 255"
+#endif
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_CUSTOM_COMMANDS) && (defined UNA_AT_BAUD_RATE_NEGOTIATION))
+#if ((UNA_AT_CUSTOM_COMMANDS_NUMBER == 0) || (UNA_AT_CUSTOM_COMMANDS_NUMBER > 255))
+#error "una-at: UNA_AT_CUSTOM_COMMANDS_NUMBER must be in the range 1 to 255"
+#endif
+#endif
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_NOTIFICATIONS))
+#if ((UNA_AT_NOTIFICATION_QUEUE_DEPTH == 0) || (UNA_AT_NOTIFICATION_QUEUE_DEPTH > 254))
+#error "una-at: UNA_AT_NOTIFICATION_QUEUE_DEPTH must be in the range 1 to 254"
+#endif
+#endif
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_BLOCK_TRANSFER))
+#if ((UNA_AT_BLOCK_WINDOW_SIZE == 0) || (UNA_AT_BLOCK_WINDOW_SIZE > 32))
+#error "una-at: UNA_AT_BLOCK_WINDOW_SIZE must be in the range 1 to 32"
+#endif
+#endif
 
 #endif /* UNA_AT_DISABLE */
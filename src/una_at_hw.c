@@ -26,4 +26,70 @@ UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_delay_milliseconds(uint32_t dela
     return status;
 }
 
+/*******************************************************************/
+UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_get_tick_ms(uint32_t* tick_ms) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(tick_ms);
+    return status;
+}
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*******************************************************************/
+UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_rx_dma_start(uint8_t* rx_buffer, uint32_t rx_buffer_size_bytes, UNA_AT_HW_rx_dma_cb_t rx_dma_callback) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(rx_buffer);
+    UNUSED(rx_buffer_size_bytes);
+    UNUSED(rx_dma_callback);
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_RX_DMA))
+/*******************************************************************/
+UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_rx_dma_stop(void) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || ((defined UNA_AT_MODE_MASTER) && (defined UNA_AT_GATEWAY))))
+/*******************************************************************/
+UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_get_destination_address(UNA_node_address_t* destination_address) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(destination_address);
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && ((defined UNA_AT_BROADCAST_NODE_ADDRESS) || (defined UNA_AT_IRQ_READ)))
+/*******************************************************************/
+UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_set_reply_mute(uint8_t mute_flag) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(mute_flag);
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_MODE_SLAVE) && (defined UNA_AT_IRQ_READ))
+/*******************************************************************/
+UNA_AT_status_t __attribute__((weak)) UNA_AT_HW_send_irq_reply(uint8_t* reply, uint32_t reply_size_bytes) {
+    // Local variables.
+    UNA_AT_status_t status = UNA_AT_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(reply);
+    UNUSED(reply_size_bytes);
+    return status;
+}
+#endif
+
 #endif /* UNA_AT_DISABLE */